@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <injector/injector.hpp>
+
+namespace
+{
+    class Base
+    {
+    public:
+        virtual int foo() = 0;
+
+        virtual ~Base() = default;
+    };
+
+    class Derived : public Base
+    {
+    public:
+        int foo() override
+        {
+            return 20;
+        }
+    };
+
+    // Shared by all benchmark threads, registrations are done before any thread resolves
+    injector::Injector& singleton_injector()
+    {
+        static injector::Injector injector = [] {
+            injector::Injector instance;
+            instance.add_singleton<Base, Derived>();
+            return instance;
+        }();
+
+        return injector;
+    }
+
+    injector::Injector& thread_local_injector()
+    {
+        static injector::Injector injector = [] {
+            injector::Injector instance;
+            instance.add_thread_local<Base, Derived>();
+            return instance;
+        }();
+
+        return injector;
+    }
+} // namespace
+
+static void BM_ContendedSingleton(benchmark::State& state)
+{
+    auto& injector = singleton_injector();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Base>());
+    }
+}
+BENCHMARK(BM_ContendedSingleton)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ContendedSingletonRef(benchmark::State& state)
+{
+    auto& injector = singleton_injector();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(&injector.get_ref<Base>());
+    }
+}
+BENCHMARK(BM_ContendedSingletonRef)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ContendedThreadLocal(benchmark::State& state)
+{
+    auto& injector = thread_local_injector();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Base>());
+    }
+}
+BENCHMARK(BM_ContendedThreadLocal)->ThreadRange(1, 8)->UseRealTime();
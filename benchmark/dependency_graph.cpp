@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <injector/injector.hpp>
+
+namespace
+{
+    // Linear chain, Chain<N> depends on Chain<N - 1>
+    template<int Depth>
+    class Chain
+    {
+    public:
+        explicit Chain(std::shared_ptr<Chain<Depth - 1>> next)
+            : m_Next(std::move(next))
+        {
+        }
+
+    private:
+        std::shared_ptr<Chain<Depth - 1>> m_Next;
+    };
+
+    template<>
+    class Chain<0>
+    {
+    };
+
+    template<int Index>
+    class Leaf
+    {
+    };
+
+    // Single node depending on one leaf per index
+    template<class Indices>
+    class Fan;
+
+    template<std::size_t... Indices>
+    class Fan<std::index_sequence<Indices...>>
+    {
+    public:
+        explicit Fan(std::shared_ptr<Leaf<Indices>>... leaves)
+            : m_Leaves{std::shared_ptr<void>(std::move(leaves))...}
+        {
+        }
+
+    private:
+        std::shared_ptr<void> m_Leaves[sizeof...(Indices)];
+    };
+
+    template<int Width>
+    using FanOut = Fan<std::make_index_sequence<Width>>;
+
+    template<int... Depths>
+    void add_chain(injector::Injector& injector, std::integer_sequence<int, Depths...> /*depths*/, bool singleton)
+    {
+        if (singleton)
+        {
+            (injector.add_singleton<Chain<Depths>>(), ...);
+        }
+        else
+        {
+            (injector.add<Chain<Depths>>(), ...);
+        }
+    }
+
+    template<std::size_t... Indices>
+    void add_leaves(injector::Injector& injector, std::index_sequence<Indices...> /*indices*/)
+    {
+        (injector.add<Leaf<Indices>>(), ...);
+    }
+} // namespace
+
+template<int Depth>
+static void BM_ResolveTransientChain(benchmark::State& state)
+{
+    injector::Injector injector;
+    add_chain(injector, std::make_integer_sequence<int, Depth + 1>(), false);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Chain<Depth>>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * (Depth + 1));
+}
+BENCHMARK_TEMPLATE(BM_ResolveTransientChain, 1);
+BENCHMARK_TEMPLATE(BM_ResolveTransientChain, 4);
+BENCHMARK_TEMPLATE(BM_ResolveTransientChain, 16);
+
+template<int Depth>
+static void BM_ResolveUnregisteredChain(benchmark::State& state)
+{
+    injector::Injector injector;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Chain<Depth>>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * (Depth + 1));
+}
+BENCHMARK_TEMPLATE(BM_ResolveUnregisteredChain, 1);
+BENCHMARK_TEMPLATE(BM_ResolveUnregisteredChain, 4);
+BENCHMARK_TEMPLATE(BM_ResolveUnregisteredChain, 16);
+
+template<int Depth>
+static void BM_ResolveTransientOnSingletonChain(benchmark::State& state)
+{
+    injector::Injector injector;
+    add_chain(injector, std::make_integer_sequence<int, Depth>(), true);
+    injector.add<Chain<Depth>>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Chain<Depth>>());
+    }
+}
+BENCHMARK_TEMPLATE(BM_ResolveTransientOnSingletonChain, 1);
+BENCHMARK_TEMPLATE(BM_ResolveTransientOnSingletonChain, 4);
+BENCHMARK_TEMPLATE(BM_ResolveTransientOnSingletonChain, 16);
+
+template<int Width>
+static void BM_ResolveFanOut(benchmark::State& state)
+{
+    injector::Injector injector;
+    add_leaves(injector, std::make_index_sequence<Width>());
+    injector.add<FanOut<Width>>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<FanOut<Width>>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * (Width + 1));
+}
+BENCHMARK_TEMPLATE(BM_ResolveFanOut, 1);
+BENCHMARK_TEMPLATE(BM_ResolveFanOut, 4);
+BENCHMARK_TEMPLATE(BM_ResolveFanOut, 16);
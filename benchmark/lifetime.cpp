@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <injector/injector.hpp>
+
+namespace
+{
+    class Base
+    {
+    public:
+        virtual int foo() = 0;
+
+        virtual ~Base() = default;
+    };
+
+    class Derived : public Base
+    {
+    public:
+        int foo() override
+        {
+            return 20;
+        }
+    };
+} // namespace
+
+static void BM_GetTransient(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add<Derived>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Derived>());
+    }
+}
+BENCHMARK(BM_GetTransient);
+
+static void BM_GetTransientFromBase(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Base>());
+    }
+}
+BENCHMARK(BM_GetTransientFromBase);
+
+static void BM_GetTransientFromFunction(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add<Base, Derived>([] {
+        return std::make_shared<Derived>();
+    });
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Base>());
+    }
+}
+BENCHMARK(BM_GetTransientFromFunction);
+
+static void BM_GetSingleton(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add_singleton<Derived>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Derived>());
+    }
+}
+BENCHMARK(BM_GetSingleton);
+
+static void BM_GetSingletonFromBase(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Base>());
+    }
+}
+BENCHMARK(BM_GetSingletonFromBase);
+
+static void BM_GetConstant(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add<Base, Derived>(std::make_shared<Derived>());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<Base>());
+    }
+}
+BENCHMARK(BM_GetConstant);
+
+static void BM_GetRefSingleton(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(&injector.get_ref<Base>());
+    }
+}
+BENCHMARK(BM_GetRefSingleton);
+
+static void BM_GetSingletonFromFrozen(benchmark::State& state)
+{
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    auto frozen = injector.freeze();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(frozen.get<Base>());
+    }
+}
+BENCHMARK(BM_GetSingletonFromFrozen);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <injector/injector.hpp>
+
+namespace
+{
+    class Base
+    {
+    public:
+        virtual int foo() = 0;
+
+        virtual ~Base() = default;
+    };
+
+    class Derived : public Base
+    {
+    public:
+        int foo() override
+        {
+            return 20;
+        }
+    };
+
+    injector::Injector make_injector(std::int64_t providers, bool singleton)
+    {
+        injector::Injector injector;
+
+        for (std::int64_t i = 0; i < providers; ++i)
+        {
+            if (singleton)
+            {
+                injector.add_singleton<Base, Derived>();
+            }
+            else
+            {
+                injector.add<Base, Derived>();
+            }
+        }
+
+        return injector;
+    }
+} // namespace
+
+static void BM_GetVectorOfTransients(benchmark::State& state)
+{
+    auto injector = make_injector(state.range(0), false);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<std::vector<Base>>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GetVectorOfTransients)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_GetVectorOfSingletons(benchmark::State& state)
+{
+    auto injector = make_injector(state.range(0), true);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(injector.get<std::vector<Base>>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GetVectorOfSingletons)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_ForEachSingleton(benchmark::State& state)
+{
+    auto injector = make_injector(state.range(0), true);
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+
+        injector.for_each<Base>([&sum](Base& base) {
+            sum += base.foo();
+        });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ForEachSingleton)->Arg(1)->Arg(10)->Arg(100);
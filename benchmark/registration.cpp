@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <injector/injector.hpp>
+
+#include <utility>
+
+namespace
+{
+    template<std::size_t Index>
+    class Component
+    {
+    };
+
+    constexpr std::size_t component_count = 256;
+
+    template<class Registrar, std::size_t... Indices>
+    void register_components(Registrar& registrar, std::index_sequence<Indices...> /*indices*/)
+    {
+        (registrar.template add_singleton<Component<Indices>>(), ...);
+    }
+} // namespace
+
+template<class Injector>
+static void BM_AddOneByOne(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Injector injector;
+        register_components(injector, std::make_index_sequence<component_count>());
+
+        benchmark::DoNotOptimize(injector.generation());
+    }
+
+    state.SetItemsProcessed(state.iterations() * component_count);
+}
+BENCHMARK_TEMPLATE(BM_AddOneByOne, injector::Injector);
+BENCHMARK_TEMPLATE(BM_AddOneByOne, injector::ConcurrentInjector);
+
+template<class Injector>
+static void BM_InstallModule(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        injector::Module module;
+        register_components(module, std::make_index_sequence<component_count>());
+
+        Injector injector;
+        injector.install(module);
+
+        benchmark::DoNotOptimize(injector.generation());
+    }
+
+    state.SetItemsProcessed(state.iterations() * component_count);
+}
+BENCHMARK_TEMPLATE(BM_InstallModule, injector::Injector);
+BENCHMARK_TEMPLATE(BM_InstallModule, injector::ConcurrentInjector);
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace injector
+{
+    /**
+     * Allocator attached to a binding.
+     * Objects created by constructor of given binding are allocated together with their control block through this allocator.
+     * @tparam Allocator standard conforming allocator, it is rebound to the constructed type
+     */
+    template<class Allocator>
+    struct WithAllocator
+    {
+        Allocator allocator;
+    };
+
+    /**
+     * Attach allocator to a binding, e.g. add<T>(with_allocator(pool)).
+     * Allocator must stay usable for as long as any object created through it is alive.
+     * @param allocator allocator to use when constructing objects
+     */
+    template<class Allocator>
+    WithAllocator<Allocator> with_allocator(const Allocator& allocator)
+    {
+        return {allocator};
+    }
+} // namespace injector
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+
+#include "injector.hpp"
+
+namespace injector
+{
+    /**
+     * Injector that overlays parent injector, e.g. tenant specific overrides on top of shared application injector.
+     * Child only keeps its own registrations, lookups that miss them fall back to the parent,
+     * so each lookup performs at most one hash lookup per level.
+     * Types registered in the child hide all registrations of the parent, including multi-bindings.
+     * Bindings of the parent are shared. Singletons and other bindings whose instances outlive single resolution
+     * resolve their dependencies in the injector owning them, thus singleton of the parent never sees overrides
+     * of the child that requested it first and never keeps handles to the child.
+     * Each child compiles resolution plans of its own, registering overrides in a child never invalidates plans
+     * of the parent or of other children.
+     * Only own singletons are created by warm_up, parent singletons are warmed up through the parent.
+     * Parent must outlive the child.
+     */
+    class ChildInjector final : public Injector
+    {
+    public:
+        /**
+         * @param parent injector providing registrations that are not overridden, it must outlive the child
+         */
+        explicit ChildInjector(InjectorBase& parent) noexcept;
+
+        ChildInjector(const ChildInjector&) = delete;
+        ChildInjector(ChildInjector&&) = delete;
+        ChildInjector& operator=(const ChildInjector&) = delete;
+        ChildInjector& operator=(ChildInjector&&) = delete;
+
+        ~ChildInjector() override = default;
+
+        // freezing would drop fallback to the parent
+        FrozenInjector freeze() = delete;
+
+        /**
+         * Changes with registrations of this injector as well as with registrations of the parent.
+         * @return current registration generation
+         */
+        [[nodiscard]] std::size_t generation() const noexcept override;
+
+    protected:
+        [[nodiscard]] IComponentProvider* find_provider(std::size_t id) const noexcept override
+        {
+            if (auto* provider = Injector::find_provider(id))
+            {
+                return provider;
+            }
+
+            return m_Parent->find_provider(id);
+        }
+
+        [[nodiscard]] ProviderRange find_providers(std::size_t id) const noexcept override
+        {
+            auto providers = Injector::find_providers(id);
+            return providers.empty() ? m_Parent->find_providers(id) : providers;
+        }
+
+        void add_providers(detail::PendingRegistrations&& registrations) override;
+
+    private:
+        InjectorBase* m_Parent;
+        mutable std::atomic<std::size_t> m_ParentGeneration;
+        mutable std::atomic<std::size_t> m_InheritedGeneration;
+    };
+} // namespace injector
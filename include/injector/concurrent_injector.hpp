@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "injector.hpp"
+
+namespace injector
+{
+    /**
+     * Injector that allows adding bindings while other threads are resolving.
+     * Registrations are published through lock-free open addressing table owned by this injector,
+     * readers probe it without taking any locks and only see providers that were fully published.
+     * Nothing that readers may still be using is modified or freed. Providers of each type are kept in blocks
+     * of growing capacity and table is grown by doubling, therefore superseded blocks and tables take at most
+     * as much memory as current ones and each registration costs amortized constant time.
+     * Installing modules publishes all of their bindings under single lock.
+     * Checks performed by try_add family are not atomic with respect to other writers.
+     */
+    class ConcurrentInjector final : public Injector
+    {
+    public:
+        ConcurrentInjector();
+
+        ConcurrentInjector(const ConcurrentInjector&) = delete;
+        ConcurrentInjector(ConcurrentInjector&&) = delete;
+        ConcurrentInjector& operator=(const ConcurrentInjector&) = delete;
+        ConcurrentInjector& operator=(ConcurrentInjector&&) = delete;
+
+        ~ConcurrentInjector() override = default;
+
+        // readers could still be using registrations, use Injector when freezing is needed
+        FrozenInjector freeze() = delete;
+
+    protected:
+        [[nodiscard]] IComponentProvider* find_provider(std::size_t id) const noexcept override
+        {
+            const auto* providers = find(id);
+            return providers ? providers->data[providers->size - 1] : nullptr;
+        }
+
+        [[nodiscard]] ProviderRange find_providers(std::size_t id) const noexcept override
+        {
+            if (const auto* providers = find(id))
+            {
+                return {providers->data, providers->data + providers->size};
+            }
+
+            return {};
+        }
+
+        [[nodiscard]] std::vector<IComponentProvider*> registered_providers() const override;
+
+        void add_provider(std::size_t id, std::unique_ptr<IComponentProvider>&& provider) override;
+
+        void add_providers(detail::PendingRegistrations&& pending) override;
+
+    private:
+        // Providers of single type as seen by readers, never modified once published
+        struct Published
+        {
+            IComponentProvider* const* data;
+            std::size_t size;
+        };
+
+        struct Slot
+        {
+            std::atomic<std::size_t> id = 0;
+            std::atomic<const Published*> providers = nullptr;
+        };
+
+        // Table is at most half full, thus every probe sequence ends at an empty slot
+        struct Table
+        {
+            explicit Table(unsigned bits);
+
+            [[nodiscard]] std::size_t index_of(std::size_t id) const noexcept
+            {
+                return static_cast<std::size_t>((static_cast<std::uint64_t>(id) * 11400714819323198485ULL) >> shift); // NOLINT magic number
+            }
+
+            unsigned shift;
+            std::size_t mask;
+            std::size_t count = 0;
+            std::unique_ptr<Slot[]> slots; // NOLINT c array
+        };
+
+        // Writer side of providers published for single type
+        struct Blocks
+        {
+            // blocks are appended only past the published size, superseded ones may still be read
+            std::vector<std::unique_ptr<IComponentProvider*[]>> blocks; // NOLINT c array
+            std::size_t capacity = 0;
+            std::size_t size = 0;
+        };
+
+        [[nodiscard]] const Published* find(std::size_t id) const noexcept
+        {
+            const auto& table = *m_Table.load(std::memory_order_acquire);
+
+            for (auto index = table.index_of(id);; index = (index + 1) & table.mask)
+            {
+                const auto& slot = table.slots[index];
+                const auto* providers = slot.providers.load(std::memory_order_acquire);
+
+                if (!providers || slot.id.load(std::memory_order_relaxed) == id)
+                {
+                    return providers;
+                }
+            }
+        }
+
+        // Publish providers registered for given type that readers cannot see yet, writer mutex must be held
+        void publish(std::size_t id);
+
+        // Point slot of given type to given providers, growing table when it gets more than half full
+        void insert(std::size_t id, const Published* providers);
+
+        static void store(Table& table, std::size_t id, const Published* providers) noexcept;
+
+        mutable std::mutex m_WriteMutex;
+        std::unordered_map<std::size_t, Blocks> m_Blocks;
+        std::vector<std::unique_ptr<const Published>> m_Published;
+        std::vector<std::unique_ptr<Table>> m_Tables;
+        std::atomic<Table*> m_Table = nullptr;
+    };
+} // namespace injector
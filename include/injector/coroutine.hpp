@@ -0,0 +1,376 @@
+#pragma once
+
+/*
+ * Optional C++20 layer for bindings whose construction awaits I/O.
+ * Library itself is built as C++17, this header is only usable from translation units compiled with coroutine support.
+ */
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+    #error "injector/coroutine.hpp requires C++20 coroutine support"
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "injector_base.hpp"
+
+#if !INJECTOR_HAS_EXCEPTIONS
+    #error "injector/coroutine.hpp requires exceptions to be enabled"
+#endif
+
+namespace injector
+{
+    /**
+     * Lazily started coroutine producing single value, it runs when awaited and resumes awaiter once finished.
+     * @tparam T type of produced value
+     */
+    template<class T>
+    class Task
+    {
+    public:
+        class promise_type
+        {
+        public:
+            Task get_return_object() noexcept
+            {
+                return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            auto final_suspend() noexcept
+            {
+                struct Continue
+                {
+                    bool await_ready() noexcept
+                    {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                    {
+                        auto continuation = handle.promise().m_Continuation;
+                        return continuation ? continuation : std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept
+                    {
+                    }
+                };
+
+                return Continue{};
+            }
+
+            template<class Value>
+            void return_value(Value&& value)
+            {
+                m_Result.template emplace<1>(std::forward<Value>(value));
+            }
+
+            void unhandled_exception() noexcept
+            {
+                m_Result.template emplace<2>(std::current_exception());
+            }
+
+        private:
+            friend class Task;
+
+            std::coroutine_handle<> m_Continuation;
+            std::variant<std::monostate, T, std::exception_ptr> m_Result;
+        };
+
+        Task(Task&& other) noexcept
+            : m_Handle(std::exchange(other.m_Handle, nullptr))
+        {
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task& operator=(Task&&) = delete;
+
+        ~Task()
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            m_Handle.promise().m_Continuation = continuation;
+            return m_Handle;
+        }
+
+        T await_resume()
+        {
+            auto& result = m_Handle.promise().m_Result;
+
+            if (result.index() == 2)
+            {
+                std::rethrow_exception(std::get<2>(result));
+            }
+
+            return std::move(std::get<1>(result));
+        }
+
+    private:
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+            : m_Handle(handle)
+        {
+        }
+
+        std::coroutine_handle<promise_type> m_Handle;
+    };
+
+    namespace detail
+    {
+        // Coroutine that starts immediately and destroys itself when finished
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                DetachedTask get_return_object() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() noexcept
+                {
+                    return {};
+                }
+
+                void return_void() noexcept
+                {
+                }
+
+                void unhandled_exception() noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+
+        /**
+         * Shared state of asynchronous singleton binding.
+         * First awaiter starts the factory, awaiters arriving while it is in flight are resumed together once it finishes.
+         * Failed construction is reported to all waiting awaiters and started again by the next one.
+         * @tparam T type of the object
+         */
+        template<class T>
+        class AsyncSingleton
+        {
+        public:
+            using factory_type = std::function<Task<std::shared_ptr<T>>(InjectorBase&)>;
+
+            explicit AsyncSingleton(factory_type factory)
+                : m_Factory(std::move(factory))
+            {
+            }
+
+            class Awaiter
+            {
+            public:
+                Awaiter(AsyncSingleton& singleton, InjectorBase& injector) noexcept
+                    : m_Singleton(std::addressof(singleton)),
+                      m_Injector(std::addressof(injector))
+                {
+                }
+
+                bool await_ready() const
+                {
+                    std::lock_guard<std::mutex> lock(m_Singleton->m_Mutex);
+                    return m_Singleton->m_Instance != nullptr;
+                }
+
+                bool await_suspend(std::coroutine_handle<> awaiter)
+                {
+                    bool start = false;
+
+                    {
+                        std::lock_guard<std::mutex> lock(m_Singleton->m_Mutex);
+
+                        if (m_Singleton->m_Instance)
+                        {
+                            return false;
+                        }
+
+                        m_Singleton->m_Waiters.push_back({awaiter, this});
+                        start = !std::exchange(m_Singleton->m_Running, true);
+                    }
+
+                    if (start)
+                    {
+                        m_Singleton->construct(*m_Injector);
+                    }
+
+                    return true;
+                }
+
+                std::shared_ptr<T> await_resume()
+                {
+                    if (m_Error)
+                    {
+                        std::rethrow_exception(m_Error);
+                    }
+
+                    std::lock_guard<std::mutex> lock(m_Singleton->m_Mutex);
+                    return m_Singleton->m_Instance;
+                }
+
+            private:
+                friend class AsyncSingleton;
+
+                AsyncSingleton* m_Singleton;
+                InjectorBase* m_Injector;
+                std::exception_ptr m_Error;
+            };
+
+        private:
+            struct Waiter
+            {
+                std::coroutine_handle<> handle;
+                Awaiter* awaiter;
+            };
+
+            DetachedTask construct(InjectorBase& injector)
+            {
+                std::shared_ptr<T> instance;
+                std::exception_ptr error;
+
+                try
+                {
+                    instance = co_await m_Factory(injector);
+
+                    if (!instance)
+                    {
+                        throw ComponentCreationException({ErrorCode::CreationFailed, type_id<T>()});
+                    }
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                std::vector<Waiter> waiters;
+
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_Instance = std::move(instance);
+                    m_Running = false;
+                    waiters.swap(m_Waiters);
+                }
+
+                for (auto& waiter : waiters)
+                {
+                    waiter.awaiter->m_Error = error;
+                    waiter.handle.resume();
+                }
+            }
+
+            factory_type m_Factory;
+            std::mutex m_Mutex;
+            std::shared_ptr<T> m_Instance;
+            std::vector<Waiter> m_Waiters;
+            bool m_Running = false;
+        };
+
+        template<class T>
+        class Resolution
+        {
+        public:
+            explicit Resolution(InjectorBase& injector)
+            {
+                if (injector.contains<AsyncSingleton<T>>())
+                {
+                    m_Awaiter.emplace(injector.get_ref<AsyncSingleton<T>>(), injector);
+                }
+                else
+                {
+                    m_Instance = injector.get<T>();
+                }
+            }
+
+            bool await_ready() const
+            {
+                return !m_Awaiter || m_Awaiter->await_ready();
+            }
+
+            bool await_suspend(std::coroutine_handle<> awaiter)
+            {
+                return m_Awaiter->await_suspend(awaiter);
+            }
+
+            std::shared_ptr<T> await_resume()
+            {
+                return m_Awaiter ? m_Awaiter->await_resume() : std::move(m_Instance);
+            }
+
+        private:
+            // engaged for asynchronous bindings, other types are resolved right away
+            std::optional<typename AsyncSingleton<T>::Awaiter> m_Awaiter;
+            std::shared_ptr<T> m_Instance;
+        };
+    } // namespace detail
+
+    /**
+     * Add binding to given type in singleton scope with coroutine factory.
+     * Factory is started by the first awaiter of resolve, awaiters arriving while it is in flight share its result.
+     * Such binding can only be retrieved with resolve.
+     * @tparam T target for binding
+     * @param injector injector to register binding in
+     * @param fn function invoked as fn(InjectorBase&) or fn(), returning Task producing std::shared_ptr<T>
+     */
+    template<class T, class Injector, class Fn>
+    void add_async_singleton(Injector& injector, Fn&& fn)
+    {
+        using singleton_type = detail::AsyncSingleton<T>;
+        typename singleton_type::factory_type factory;
+
+        if constexpr (std::is_invocable_v<Fn&, InjectorBase&>)
+        {
+            factory = std::forward<Fn>(fn);
+        }
+        else
+        {
+            factory = [fn = std::forward<Fn>(fn)](InjectorBase& /*injector*/) mutable {
+                return fn();
+            };
+        }
+
+        injector.template add<singleton_type, singleton_type>(std::make_shared<singleton_type>(std::move(factory)));
+    }
+
+    /**
+     * Resolve object of given type from coroutine, as co_await resolve<T>(injector).
+     * Types registered with add_async_singleton are awaited, other types are retrieved synchronously with get.
+     * Awaiting coroutine is resumed on the thread that finished construction.
+     * @tparam T type to retrieve
+     * @param injector injector to resolve object from, it must outlive the resolution
+     * @return awaitable producing std::shared_ptr<T>
+     * @throws ComponentCreationException from co_await if object could not be created
+     */
+    template<class T>
+    detail::Resolution<T> resolve(InjectorBase& injector)
+    {
+        return detail::Resolution<T>(injector);
+    }
+} // namespace injector
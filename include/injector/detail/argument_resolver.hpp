@@ -1,6 +1,23 @@
 #pragma once
 
-#include "injector/injector.hpp"
+#include <limits>
+
+#include "injector/injector_base.hpp"
+#include "injector/lazy.hpp"
+#include "injector/detail/resolution_plan.hpp"
+
+// Compiler builtin skips instantiating std::is_constructible, which dominates cost of constructor arity detection
+#if defined(__has_builtin)
+    #if __has_builtin(__is_constructible)
+        #define INJECTOR_IS_CONSTRUCTIBLE(...) __is_constructible(__VA_ARGS__)
+    #endif
+#elif defined(_MSC_VER)
+    #define INJECTOR_IS_CONSTRUCTIBLE(...) __is_constructible(__VA_ARGS__)
+#endif
+
+#ifndef INJECTOR_IS_CONSTRUCTIBLE
+    #define INJECTOR_IS_CONSTRUCTIBLE(...) std::is_constructible_v<__VA_ARGS__>
+#endif
 
 namespace injector::detail
 {
@@ -8,18 +25,178 @@ namespace injector::detail
     class ConstructorArgumentResolver
     {
     public:
-        explicit ConstructorArgumentResolver(injector::Injector& injector)
+        explicit ConstructorArgumentResolver(injector::InjectorBase& injector)
             : m_Injector(std::addressof(injector))
         {
         }
 
+        /**
+         * Create resolver backed by provider taken from resolution plan.
+         * @param injector injector used for resolution
+         * @param provider provider of the argument this resolver will be converted to
+         * @param compiled whether provider comes from compiled plan, otherwise it is looked up and stored
+         */
+        ConstructorArgumentResolver(injector::InjectorBase& injector, IComponentProvider*& provider, bool compiled)
+            : m_Injector(std::addressof(injector)),
+              m_Provider(std::addressof(provider)),
+              m_Compiled(compiled)
+        {
+        }
+
         template<class ConstructorArgument, typename std::enable_if_t<!std::is_same_v<ConstructorArgument, T> && !std::is_same_v<ConstructorArgument, ConstructorArgument&> && !std::is_pointer_v<ConstructorArgument>, bool> = true>
         operator ConstructorArgument() // NOLINT implicit conversion
         {
-            return m_Injector->get<ConstructorArgument>();
+            if constexpr (is_handle_v<ConstructorArgument>)
+            {
+                return ConstructorArgument(*m_Injector);
+            }
+            else
+            {
+                if constexpr (is_shared_v<ConstructorArgument>)
+                {
+                    if (m_Provider)
+                    {
+                        return resolve<typename ConstructorArgument::element_type>();
+                    }
+                }
+
+                return m_Injector->get<ConstructorArgument>();
+            }
         }
 
     private:
-        injector::Injector* m_Injector;
+        template<class Argument>
+        std::shared_ptr<Argument> resolve()
+        {
+            if (!m_Compiled)
+            {
+                *m_Provider = m_Injector->find_provider(type_id<Argument>());
+            }
+
+            auto* provider = *m_Provider;
+
+            if (!provider)
+            {
+                return m_Injector->get<Argument>();
+            }
+
+            auto* component_provider = provider_cast<Argument>(provider);
+
+            if (!component_provider)
+            {
+                return nullptr;
+            }
+
+            auto value = component_provider->get_fast(*m_Injector);
+
+            if (!value)
+            {
+                raise({ErrorCode::CreationFailed, type_id<Argument>()});
+            }
+
+            return value;
+        }
+
+        injector::InjectorBase* m_Injector;
+        IComponentProvider** m_Provider = nullptr;
+        bool m_Compiled = false;
+    };
+
+    constexpr std::size_t max_constructor_arguments = 32;
+
+    template<class Resolver, std::size_t Index>
+    using indexed_resolver = Resolver;
+
+    // Index sequences do not depend on the constructed type, thus they are instantiated once for all types
+    template<class T, class Resolver, class Indices>
+    constexpr bool is_constructible_from_resolvers = false;
+
+    template<class T, class Resolver, std::size_t... Indices>
+    constexpr bool is_constructible_from_resolvers<T, Resolver, std::index_sequence<Indices...>> = INJECTOR_IS_CONSTRUCTIBLE(T, indexed_resolver<Resolver, Indices>...);
+
+    /*
+     * Every arity is checked within single fold expression and the last satisfiable one wins, so each type costs
+     * one is_constructible check per arity without recursive instantiations. Constructibility is not monotonic
+     * in the number of arguments, which rules out bisecting the range or stopping early.
+     */
+    template<class T, class Resolver, std::size_t... Arities>
+    constexpr std::size_t find_constructor_arity(std::index_sequence<Arities...> /*arities*/)
+    {
+        std::size_t arity = 0;
+        ((arity = is_constructible_from_resolvers<T, Resolver, std::make_index_sequence<Arities>> ? Arities : arity), ...);
+
+        return arity;
+    }
+
+    // Number of arguments of the widest constructor that can be satisfied by given resolver, 0 if there is none
+    template<class T, class Resolver>
+    struct constructor_arity : std::integral_constant<std::size_t, find_constructor_arity<T, Resolver>(std::make_index_sequence<max_constructor_arguments + 1>())>
+    {
+    };
+
+    template<class T, class Resolver = ConstructorArgumentResolver<T>>
+    inline constexpr std::size_t constructor_arity_v = constructor_arity<T, Resolver>::value;
+
+    template<class Fn, class Resolver, std::size_t... Indices>
+    constexpr bool is_invocable_with_resolvers(std::index_sequence<Indices...> /*indices*/)
+    {
+        return std::is_invocable_v<Fn&, indexed_resolver<Resolver, Indices>...>;
+    }
+
+    constexpr std::size_t no_function_arity = std::numeric_limits<std::size_t>::max();
+
+    template<class Fn, class Resolver, std::size_t N>
+    constexpr std::size_t find_function_arity()
+    {
+        if constexpr (N > max_constructor_arguments)
+        {
+            return no_function_arity;
+        }
+        else if constexpr (is_invocable_with_resolvers<Fn, Resolver>(std::make_index_sequence<N>()))
+        {
+            return N;
+        }
+        else
+        {
+            return find_function_arity<Fn, Resolver, N + 1>();
+        }
+    }
+
+    // Number of parameters of given callable that are resolved by given resolver, no_function_arity if it cannot be invoked
+    template<class Fn, class Resolver>
+    struct function_arity : std::integral_constant<std::size_t, find_function_arity<Fn, Resolver, 0>()>
+    {
     };
-} // namespace injector::detail
\ No newline at end of file
+
+    template<class Fn, class Resolver, class Indices>
+    struct function_result;
+
+    template<class Fn, class Resolver, std::size_t... Indices>
+    struct function_result<Fn, Resolver, std::index_sequence<Indices...>>
+    {
+        using type = std::invoke_result_t<Fn&, indexed_resolver<Resolver, Indices>...>;
+    };
+
+    template<class Fn, class T, bool Invocable = function_arity<Fn, ConstructorArgumentResolver<T>>::value != no_function_arity>
+    struct is_factory_function : std::false_type
+    {
+    };
+
+    template<class Fn, class T>
+    struct is_factory_function<Fn, T, true>
+        : std::is_convertible<typename function_result<Fn, ConstructorArgumentResolver<T>, std::make_index_sequence<function_arity<Fn, ConstructorArgumentResolver<T>>::value>>::type, std::shared_ptr<T>>
+    {
+    };
+
+    // Whether given callable can be used as factory of given type with its parameters injected
+    template<class Fn, class T>
+    constexpr bool is_factory_function_v = is_factory_function<std::decay_t<Fn>, T>::value;
+
+    // Whether injector can construct given type without any binding
+    template<class T>
+    struct is_injectable : std::bool_constant<!std::is_abstract_v<T> && (std::is_default_constructible_v<T> || constructor_arity_v<T> != 0)>
+    {
+    };
+} // namespace injector::detail
+
+#include "injector/detail/dependencies.hpp"
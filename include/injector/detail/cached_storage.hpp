@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <mutex>
+
+#include "injector/detail/storage.hpp"
+
+namespace injector
+{
+    /**
+     * Limit total size of objects kept by cached bindings of all injectors, least recently used ones are released first.
+     * Objects that are still referenced elsewhere stay alive regardless of the limit.
+     * @param bytes maximum total of size estimates of kept objects, unlimited by default
+     */
+    void set_cache_budget(std::size_t bytes);
+
+    /**
+     * Release objects of cached bindings that have been idle for longer than their timeout.
+     * Idle objects are also released whenever any cached binding creates new object, calling this periodically
+     * releases them while cached bindings keep reusing their objects.
+     */
+    void trim_cache();
+
+    namespace detail
+    {
+        /**
+         * Keeps the last object of a cached binding alive, entries of all bindings form single least recently used list.
+         * Entry only holds its object while it is recently used and fits into cache budget.
+         * Reuse of kept object only records time of use, entry is moved to the front of the list at most once per touch_interval.
+         */
+        class CacheEntry
+        {
+        public:
+            using clock = std::chrono::steady_clock;
+
+            // entries reused more often keep their position in the list, thus their order is only that precise
+            static constexpr auto touch_interval = std::chrono::milliseconds(1);
+
+            CacheEntry(std::chrono::nanoseconds idle_timeout, std::size_t size);
+
+            CacheEntry(const CacheEntry&) = delete;
+            CacheEntry& operator=(const CacheEntry&) = delete;
+
+            ~CacheEntry();
+
+            /**
+             * Keep given object and mark it as most recently used.
+             * Entries exceeding their limits are released once object starts being kept, e.g. after it has been created.
+             * @param instance object to keep, the same one entry keeps already unless entry has released it
+             */
+            void touch(std::shared_ptr<void> instance);
+
+        private:
+            friend class CacheRegistry;
+
+            std::chrono::nanoseconds m_IdleTimeout;
+            std::size_t m_Size;
+
+            // time since clock epoch, written on each use without taking registry lock
+            std::atomic<clock::rep> m_LastUse = 0;
+
+            // written by registry only, read on reuse to decide whether registry has to be locked
+            std::atomic<bool> m_Kept = false;
+            std::atomic<clock::rep> m_Touched = 0;
+
+            // guarded by registry
+            std::shared_ptr<void> m_Instance;
+            CacheEntry* m_Previous = nullptr;
+            CacheEntry* m_Next = nullptr;
+        };
+
+        template<class T, class Factory>
+        class CachedInstanceStorage final : private InstanceStorage<T, Factory>
+        {
+            using base = InstanceStorage<T, Factory>;
+
+        public:
+            using value_type = T;
+
+            static constexpr bool is_singleton = false;
+            static constexpr bool resolves_in_owner = true;
+
+            /**
+             * @param idle_timeout time after last retrieval when object is released
+             * @param size estimated size of the object counted against cache budget
+             * @param args arguments forwarded to factory
+             */
+            template<class... Args>
+            CachedInstanceStorage(std::chrono::nanoseconds idle_timeout, std::size_t size, Args&&... args)
+                : base(std::forward<Args>(args)...),
+                  m_Entry(idle_timeout, size)
+            {
+            }
+
+            /**
+             * Hand out the last object if it is still alive, either kept by the cache or referenced elsewhere,
+             * otherwise create new one.
+             */
+            std::shared_ptr<T> get(InjectorBase& injector)
+            {
+                std::shared_ptr<T> instance;
+
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+
+                    instance = m_Instance.lock();
+
+                    if (!instance)
+                    {
+                        instance = base::get(injector);
+
+                        // failed creation is not cached, next retrieval will try again
+                        if (!instance)
+                        {
+                            return nullptr;
+                        }
+
+                        m_Instance = instance;
+                    }
+                }
+
+                // touching may release objects of other entries, which must not happen while binding is locked
+                m_Entry.touch(instance);
+                return instance;
+            }
+
+            // Object can be released at any time, thus it cannot be borrowed
+            T* borrow(InjectorBase& /*injector*/) noexcept
+            {
+                return nullptr;
+            }
+
+        private:
+            std::mutex m_Mutex;
+            std::weak_ptr<T> m_Instance;
+            CacheEntry m_Entry;
+        };
+    } // namespace detail
+} // namespace injector
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+
+#include "injector/injector_base.hpp"
+#include "injector/detail/argument_resolver.hpp"
+
+namespace injector::detail
+{
+    /*
+     * Constructor arguments are discovered without creating any object. DependencyProbe converts to the same
+     * argument types as ConstructorArgumentResolver, so the same constructor is selected. Construction from probes
+     * is instantiated but never executed, and instantiating each conversion defines describe function of its argument.
+     * Dependency table of the factory is built from those functions on first use, thus it does not depend
+     * on order of static initialization.
+     */
+
+    template<class T>
+    struct argument_dependency
+    {
+        static constexpr DependencyKind kind = DependencyKind::Shared;
+        using type = T;
+    };
+
+    template<class T>
+    struct argument_dependency<std::shared_ptr<T>>
+    {
+        static constexpr DependencyKind kind = DependencyKind::Shared;
+        using type = T;
+    };
+
+    template<class T>
+    struct argument_dependency<std::unique_ptr<T>>
+    {
+        static constexpr DependencyKind kind = DependencyKind::Exclusive;
+        using type = T;
+    };
+
+    template<class T>
+    struct argument_dependency<std::vector<T>>
+    {
+        static constexpr DependencyKind kind = DependencyKind::Multiple;
+        using type = T;
+    };
+
+    template<class T>
+    struct argument_dependency<std::vector<std::shared_ptr<T>>>
+    {
+        static constexpr DependencyKind kind = DependencyKind::Multiple;
+        using type = T;
+    };
+
+    template<class T>
+    struct argument_dependency<Lazy<T>>
+    {
+        static constexpr DependencyKind kind = DependencyKind::Deferred;
+        using type = T;
+    };
+
+    template<class T>
+    struct argument_dependency<Provider<T>>
+    {
+        static constexpr DependencyKind kind = DependencyKind::Deferred;
+        using type = T;
+    };
+
+    template<class Key>
+    const DependencyTable* dependencies_of() noexcept;
+
+    // Dependencies of type that is constructed directly, when it has no binding
+    template<class T>
+    struct ConstructorKey;
+
+    template<class Argument>
+    Dependency describe_dependency() noexcept
+    {
+        using type = typename argument_dependency<Argument>::type;
+
+        if constexpr (detail::is_injectable<type>::value)
+        {
+            return {argument_dependency<Argument>::kind, type_id<type>(), type_name<type>(), &dependencies_of<ConstructorKey<type>>};
+        }
+        else
+        {
+            return {argument_dependency<Argument>::kind, type_id<type>(), type_name<type>(), nullptr};
+        }
+    }
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wnon-template-friend"
+#endif
+
+    // Declares describe function of single argument, it is defined by conversion that the argument is created from
+    template<class Key, std::size_t Index>
+    struct ArgumentSlot
+    {
+        friend Dependency describe(ArgumentSlot) noexcept;
+    };
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+    template<class Key, std::size_t Index, class Argument>
+    struct RecordedArgument
+    {
+        friend Dependency describe(ArgumentSlot<Key, Index> /*slot*/) noexcept
+        {
+            return describe_dependency<Argument>();
+        }
+    };
+
+    template<class Key, class T, std::size_t Index>
+    class DependencyProbe
+    {
+    public:
+        template<class ConstructorArgument, typename std::enable_if_t<!std::is_same_v<ConstructorArgument, T> && !std::is_same_v<ConstructorArgument, ConstructorArgument&> && !std::is_pointer_v<ConstructorArgument>, bool> = true>
+        operator ConstructorArgument() const // NOLINT implicit conversion
+        {
+            static_cast<void>(sizeof(RecordedArgument<Key, Index, std::remove_cv_t<ConstructorArgument>>));
+            std::abort();
+        }
+    };
+
+    template<class T>
+    struct ConstructorKey
+    {
+        static constexpr std::size_t arity = constructor_arity_v<T>;
+        static constexpr bool constructible = is_injectable<T>::value;
+
+        template<std::size_t... Indices>
+        static void probe(std::index_sequence<Indices...> /*indices*/)
+        {
+            static_cast<void>(new T(DependencyProbe<ConstructorKey, T, Indices>()...)); // NOLINT never executed
+        }
+    };
+
+    template<class T, class Fn>
+    struct FunctionKey
+    {
+        static constexpr bool constructible = function_arity<Fn, ConstructorArgumentResolver<T>>::value != no_function_arity;
+        static constexpr std::size_t arity = constructible ? function_arity<Fn, ConstructorArgumentResolver<T>>::value : 0;
+
+        template<std::size_t... Indices>
+        static void probe(Fn& fn, std::index_sequence<Indices...> /*indices*/)
+        {
+            static_cast<void>(fn(DependencyProbe<FunctionKey, T, Indices>()...));
+        }
+    };
+
+    template<class Key, std::size_t... Indices>
+    constexpr auto probe_of(std::index_sequence<Indices...> /*indices*/) noexcept
+    {
+        return &Key::template probe<Indices...>;
+    }
+
+    template<class Key, std::size_t... Indices>
+    std::vector<Dependency> describe_arguments(std::index_sequence<Indices...> /*indices*/)
+    {
+        return {describe(ArgumentSlot<Key, Indices>())...};
+    }
+
+    template<class Key>
+    const DependencyTable* dependencies_of() noexcept
+    {
+        if constexpr (Key::arity != 0)
+        {
+            // instantiates argument conversions, the probe itself is never called
+            static_cast<void>(probe_of<Key>(std::make_index_sequence<Key::arity>()));
+        }
+
+        static const DependencyTable table{Key::constructible, describe_arguments<Key>(std::make_index_sequence<Key::arity>())};
+        return &table;
+    }
+
+    template<class Factory>
+    struct factory_dependencies
+    {
+        static const DependencyTable* get() noexcept
+        {
+            static const DependencyTable none{true, {}};
+            return &none;
+        }
+    };
+
+    template<class T, class Allocator>
+    struct factory_dependencies<ConstructorFactory<T, Allocator>>
+    {
+        static const DependencyTable* get() noexcept
+        {
+            return dependencies_of<ConstructorKey<T>>();
+        }
+    };
+
+    template<class T, class Fn>
+    struct factory_dependencies<FunctionFactory<T, Fn>>
+    {
+        static const DependencyTable* get() noexcept
+        {
+            return dependencies_of<FunctionKey<T, Fn>>();
+        }
+    };
+} // namespace injector::detail
@@ -1,155 +1,287 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <functional>
 
+#include "injector/errors.hpp"
+
 namespace injector
 {
-    class Injector;
+    class InjectorBase;
 } // namespace injector
 
 namespace injector::detail
 {
-    using injector::Injector;
+    using injector::InjectorBase;
 
     template<class T>
     class ConstructorArgumentResolver;
 
-    template<class T>
-    class ComponentFactory
-    {
-    public:
-        virtual std::shared_ptr<T> build(Injector& injector) = 0;
+    template<class T, class Resolver = ConstructorArgumentResolver<T>>
+    struct constructor_arity;
 
-        virtual ~ComponentFactory() = default;
-    };
+    template<class Fn, class Resolver>
+    struct function_arity;
 
-    template<class T, class Enable = void>
-    class ConstructorFactory : public ComponentFactory<T>
+    template<class Factory, std::size_t N>
+    class PlannedArguments;
+
+    // Factories are stored by value inside bindings, each of them exposes non-virtual build(InjectorBase&)
+
+    template<class T, class Allocator = std::allocator<T>, class Enable = void>
+    class ConstructorFactory
     {
     public:
-        std::shared_ptr<T> build(Injector&  /*injector*/) override
+        ConstructorFactory() = default;
+
+        explicit ConstructorFactory(const Allocator& /*allocator*/)
+        {
+        }
+
+        std::shared_ptr<T> build(InjectorBase& /*injector*/)
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<T> build_unique(InjectorBase& /*injector*/)
         {
             return nullptr;
         }
     };
 
     // Specialization for constructors with no arguments
-    template<class T>
-    class ConstructorFactory<T, typename std::enable_if_t<std::is_default_constructible_v<T> && !std::is_abstract_v<T>>> : public ComponentFactory<T>
+    template<class T, class Allocator>
+    class ConstructorFactory<T, Allocator, typename std::enable_if_t<std::is_default_constructible_v<T> && !std::is_abstract_v<T>>>
     {
     public:
-        std::shared_ptr<T> build(Injector&  /*injector*/) override
+        ConstructorFactory() = default;
+
+        explicit ConstructorFactory(const Allocator& allocator)
+            : m_Allocator(allocator)
         {
-            return std::make_shared<T>();
         }
+
+        std::shared_ptr<T> build(InjectorBase& /*injector*/)
+        {
+            return std::allocate_shared<T>(m_Allocator);
+        }
+
+        std::unique_ptr<T> build_unique(InjectorBase& /*injector*/)
+        {
+            return std::make_unique<T>();
+        }
+
+        T build_value(InjectorBase& /*injector*/)
+        {
+            return T();
+        }
+
+    private:
+        Allocator m_Allocator{};
     };
 
     // Specialization for constructors up to 32 arguments
-    template<class T>
-    class ConstructorFactory<T, typename std::enable_if_t<!std::is_default_constructible_v<T> && !std::is_abstract_v<T>>> : public ComponentFactory<T>
+    template<class T, class Allocator>
+    class ConstructorFactory<T, Allocator, typename std::enable_if_t<!std::is_default_constructible_v<T> && !std::is_abstract_v<T>>>
     {
+        static constexpr std::size_t arity = constructor_arity<T>::value;
+
     public:
-        std::shared_ptr<T> build(Injector& injector) override
-        {
-            return try_build(
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector),
-                ConstructorArgumentResolver<T>(injector));
+        ConstructorFactory() = default;
+
+        explicit ConstructorFactory(const Allocator& allocator)
+            : m_Allocator(allocator)
+        {
         }
 
-    private:
-        template<class Arg1, class Arg2, class... Args,
-                 typename std::enable_if_t<std::is_constructible_v<T, Arg1, Arg2, Args...>, bool> = true>
-        std::shared_ptr<T> try_build(Arg1& arg1, Arg2& arg2, Args&&... args)
+        std::shared_ptr<T> build(InjectorBase& injector)
+        {
+            return construct<std::shared_ptr<T>>(injector, std::make_index_sequence<arity>(), [this](auto&&... resolvers) {
+                return std::allocate_shared<T>(m_Allocator, std::forward<decltype(resolvers)>(resolvers)...);
+            });
+        }
+
+        std::unique_ptr<T> build_unique(InjectorBase& injector)
         {
-            return std::make_shared<T>(arg1, arg2, std::forward<Args>(args)...);
+            return construct<std::unique_ptr<T>>(injector, std::make_index_sequence<arity>(), [](auto&&... resolvers) {
+                return std::make_unique<T>(std::forward<decltype(resolvers)>(resolvers)...);
+            });
         }
 
-        template<class Arg1, class Arg2, class... Args,
-                 typename std::enable_if_t<!std::is_constructible_v<T, Arg1, Arg2, Args...>, bool> = true>
-        std::shared_ptr<T> try_build(Arg1&  /*arg1*/, Arg2& arg2, Args&&... args)
+        T build_value(InjectorBase& injector)
         {
-            return try_build(arg2, std::forward<Args>(args)...);
+            static_assert(arity != 0, "No constructor can be satisfied by the injector");
+
+            PlannedArguments<ConstructorFactory, arity> arguments(injector);
+
+#if !INJECTOR_HAS_EXCEPTIONS
+            // value cannot be returned without its dependencies
+            if (!arguments.resolvable(injector))
+            {
+                std::abort();
+            }
+#endif
+
+            T instance = make_value(injector, arguments, std::make_index_sequence<arity>());
+            arguments.commit();
+
+            return instance;
         }
 
-        template<class Arg,
-                 typename std::enable_if_t<std::is_constructible_v<T, Arg>, bool> = true>
-        std::shared_ptr<T> try_build(Arg& arg)
+    private:
+        template<class Pointer, std::size_t... Indices, class Create>
+        Pointer construct(InjectorBase& injector, std::index_sequence<Indices...> /*indices*/, Create&& create)
         {
-            return std::make_shared<T>(arg);
+            if constexpr (arity == 0)
+            {
+                return nullptr;
+            }
+            else
+            {
+                PlannedArguments<ConstructorFactory, arity> arguments(injector);
+
+#if !INJECTOR_HAS_EXCEPTIONS
+                if (!arguments.resolvable(injector))
+                {
+                    return nullptr;
+                }
+#endif
+
+                [[maybe_unused]] const auto failures = failure_count();
+                Pointer instance = create(ConstructorArgumentResolver<T>(injector, arguments.provider(Indices), arguments.compiled())...);
+
+#if !INJECTOR_HAS_EXCEPTIONS
+                // factory of dependency returned nullptr while exceptions are disabled, object got nullptr instead of it
+                if (failure_count() != failures)
+                {
+                    return nullptr;
+                }
+#endif
+
+                arguments.commit();
+                return instance;
+            }
         }
 
-        template<class Arg,
-                 typename std::enable_if_t<!std::is_constructible_v<T, Arg>, bool> = true>
-        std::shared_ptr<T> try_build(Arg&  /*arg*/)
+        template<std::size_t... Indices>
+        T make_value(InjectorBase& injector, PlannedArguments<ConstructorFactory, arity>& arguments, std::index_sequence<Indices...> /*indices*/)
         {
-            return nullptr;
+            return T(ConstructorArgumentResolver<T>(injector, arguments.provider(Indices), arguments.compiled())...);
         }
+
+        Allocator m_Allocator{};
     };
 
-    template<class T>
-    class FunctionFactory : public ComponentFactory<T>
+    /**
+     * Factory that invokes callable stored inline, parameters of the callable are resolved like constructor arguments.
+     * @tparam T type of created object
+     * @tparam Fn callable returning object convertible to std::shared_ptr<T>
+     */
+    template<class T, class Fn = std::function<std::shared_ptr<T>()>>
+    class FunctionFactory
     {
+        static constexpr std::size_t arity = function_arity<Fn, ConstructorArgumentResolver<T>>::value;
+
     public:
-        explicit FunctionFactory(const std::function<std::shared_ptr<T>()>& factory)
-            : m_Factory(factory)
+        template<class Factory>
+        explicit FunctionFactory(Factory&& factory)
+            : m_Factory(std::forward<Factory>(factory))
         {
         }
 
-        std::shared_ptr<T> build(Injector&  /*injector*/) override
+        std::shared_ptr<T> build(InjectorBase& injector)
         {
-            return m_Factory();
+            return build(injector, std::make_index_sequence<arity>());
         }
 
     private:
-        std::function<std::shared_ptr<T>()> m_Factory;
+        template<std::size_t... Indices>
+        std::shared_ptr<T> build(InjectorBase& injector, std::index_sequence<Indices...> /*indices*/)
+        {
+            if constexpr (arity == 0)
+            {
+                return m_Factory();
+            }
+            else
+            {
+                PlannedArguments<FunctionFactory, arity> arguments(injector);
+
+#if !INJECTOR_HAS_EXCEPTIONS
+                if (!arguments.resolvable(injector))
+                {
+                    return nullptr;
+                }
+#endif
+
+                [[maybe_unused]] const auto failures = failure_count();
+                std::shared_ptr<T> instance = m_Factory(ConstructorArgumentResolver<T>(injector, arguments.provider(Indices), arguments.compiled())...);
+
+#if !INJECTOR_HAS_EXCEPTIONS
+                if (failure_count() != failures)
+                {
+                    return nullptr;
+                }
+#endif
+
+                arguments.commit();
+                return instance;
+            }
+        }
+
+        Fn m_Factory;
     };
 
-    template<class T>
-    class ConstantFactory : public ComponentFactory<T>
+    /**
+     * @tparam T type of the object
+     * @tparam Interface type object is kept and handed out as, base of T the binding is registered for
+     */
+    template<class T, class Interface = T>
+    class ConstantFactory
     {
     public:
         explicit ConstantFactory(const std::shared_ptr<T>& data)
-            : m_Data(data)
+            : m_Data(data),
+              m_Object(data.get())
         {
         }
 
-        std::shared_ptr<T> build(Injector&  /*injector*/) override
+        std::shared_ptr<T> build(InjectorBase& /*injector*/)
+        {
+            return std::shared_ptr<T>(m_Data, m_Object);
+        }
+
+        [[nodiscard]] T* data() const noexcept
+        {
+            return m_Object;
+        }
+
+        [[nodiscard]] const std::shared_ptr<Interface>& instance() const noexcept
         {
             return m_Data;
         }
 
     private:
-        std::shared_ptr<T> m_Data;
+        std::shared_ptr<Interface> m_Data;
+        T* m_Object;
     };
+
+    // Whether given factory constructs objects directly, thus it can also create them without shared ownership
+    template<class Factory>
+    struct is_constructor_factory : std::false_type {};
+
+    template<class T>
+    struct is_constructor_factory<ConstructorFactory<T>> : std::true_type {};
+
+    template<class Factory>
+    constexpr bool is_constructor_factory_v = is_constructor_factory<Factory>::value;
+
+    template<class Factory>
+    struct is_constant_factory : std::false_type {};
+
+    template<class T, class Interface>
+    struct is_constant_factory<ConstantFactory<T, Interface>> : std::true_type {};
+
+    template<class Factory>
+    constexpr bool is_constant_factory_v = is_constant_factory<Factory>::value;
 } // namespace injector::detail
\ No newline at end of file
@@ -0,0 +1,361 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "injector/detail/thread_local_storage.hpp"
+
+namespace injector::detail
+{
+    /**
+     * Idle objects of single pooled binding.
+     * Released objects are first kept in cache of releasing thread and spill over to shared list once it is full.
+     * Caches and shared list draw from the same capacity, objects that do not fit into it are destroyed.
+     * Cache keeps capacity it has drawn until it is destroyed, thus steady reuse on one thread touches no shared memory.
+     * Pool is freed once its binding, every object it created and every cache are gone, therefore handles
+     * only keep raw pointer to node of their object and handing out an object never touches shared reference count.
+     * @tparam T type of pooled objects
+     */
+    template<class T>
+    class ObjectPool
+    {
+    public:
+        // Upper bound of idle objects kept by each thread
+        static constexpr std::size_t thread_cache_capacity = 8;
+
+        // Pooled object together with the pool it returns to, allocated once per object and shared by all its handles
+        struct Node
+        {
+            std::shared_ptr<T> object;
+            ObjectPool* pool;
+            Node* next = nullptr;
+        };
+
+        /**
+         * Pool is referenced by its binding until orphan is called.
+         * @param capacity maximum number of idle objects kept by the pool, including thread caches
+         * @param reset invoked on each object before it is returned to the pool, must not throw
+         */
+        ObjectPool(std::size_t capacity, std::function<void(T&)> reset)
+            : m_Reset(std::move(reset)),
+              m_Available(capacity)
+        {
+        }
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /**
+         * @return idle node or nullptr if pool is empty
+         */
+        Node* acquire()
+        {
+            if (auto* cache = thread_cache(); cache && !cache->nodes.empty())
+            {
+                auto* node = cache->nodes.back();
+                cache->nodes.pop_back();
+                return node;
+            }
+
+            SpinLock lock(m_Lock);
+            auto* node = m_Shared;
+
+            if (node)
+            {
+                m_Shared = node->next;
+                m_Available.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return node;
+        }
+
+        /**
+         * Take over newly created object, pool stays alive until its node is destroyed.
+         * @param object object created by factory of the binding
+         * @return node to be handed out
+         */
+        Node* adopt(std::shared_ptr<T> object)
+        {
+            auto node = std::make_unique<Node>(Node{std::move(object), this});
+            m_References.fetch_add(1, std::memory_order_relaxed);
+
+            return node.release();
+        }
+
+        /**
+         * Return object to the pool, never allocates or blocks on a mutex.
+         * @param node node that was handed out from this pool
+         */
+        void release(Node* node) noexcept
+        {
+            if (!m_Orphaned.load(std::memory_order_acquire))
+            {
+                if (m_Reset)
+                {
+                    m_Reset(*node->object);
+                }
+
+                // caches are reserved up front, thus pushing into them does not allocate
+                if (auto* cache = existing_thread_cache(); cache && cache->push(node))
+                {
+                    return;
+                }
+
+                SpinLock lock(m_Lock);
+
+                if (!m_Orphaned.load(std::memory_order_relaxed) && take_capacity())
+                {
+                    node->next = m_Shared;
+                    m_Shared = node;
+                    return;
+                }
+            }
+
+            destroy(node);
+        }
+
+        /**
+         * Drop reference of the binding, shared list is emptied and released objects are no longer kept.
+         * Objects already kept by thread caches are destroyed together with the caches.
+         */
+        void orphan()
+        {
+            Node* idle = nullptr;
+
+            {
+                SpinLock lock(m_Lock);
+                m_Orphaned.store(true, std::memory_order_release);
+                idle = std::exchange(m_Shared, nullptr);
+            }
+
+            while (idle)
+            {
+                destroy(std::exchange(idle, idle->next));
+            }
+
+            // caches of this pool get replaced by the next binding that reuses the slot
+            m_Slot.release();
+            unreference();
+        }
+
+    private:
+        // Guards shared list, it never throws so that release can stay noexcept
+        class SpinLock
+        {
+        public:
+            explicit SpinLock(std::atomic_flag& flag) noexcept
+                : m_Flag(flag)
+            {
+                while (m_Flag.test_and_set(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            SpinLock(const SpinLock&) = delete;
+            SpinLock& operator=(const SpinLock&) = delete;
+
+            ~SpinLock()
+            {
+                m_Flag.clear(std::memory_order_release);
+            }
+
+        private:
+            std::atomic_flag& m_Flag;
+        };
+
+        // Idle objects of single thread, capacity drawn from the pool is given back once the cache is destroyed
+        struct ThreadCache
+        {
+            explicit ThreadCache(ObjectPool& owner)
+                : pool(owner)
+            {
+                nodes.reserve(thread_cache_capacity);
+                pool.m_References.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            ThreadCache(const ThreadCache&) = delete;
+            ThreadCache& operator=(const ThreadCache&) = delete;
+
+            ~ThreadCache()
+            {
+                for (auto* node : nodes)
+                {
+                    pool.destroy(node);
+                }
+
+                pool.m_Available.fetch_add(reserved, std::memory_order_relaxed);
+                pool.unreference();
+            }
+
+            bool push(Node* node) noexcept
+            {
+                if (nodes.size() == reserved)
+                {
+                    if (reserved == thread_cache_capacity || !pool.take_capacity())
+                    {
+                        return false;
+                    }
+
+                    ++reserved;
+                }
+
+                nodes.push_back(node);
+                return true;
+            }
+
+            ObjectPool& pool;
+            std::vector<Node*> nodes;
+            std::size_t reserved = 0;
+        };
+
+        ~ObjectPool() = default;
+
+        ThreadCache* existing_thread_cache() const noexcept
+        {
+            if (auto* cell = m_Slot.find())
+            {
+                return static_cast<ThreadCache*>(cell->instance.get());
+            }
+
+            return nullptr;
+        }
+
+        // Threads that are destroying their thread local objects have no cache, they only use shared list
+        ThreadCache* thread_cache()
+        {
+            if (auto* cache = existing_thread_cache())
+            {
+                return cache;
+            }
+
+            auto cache = std::make_shared<ThreadCache>(*this);
+
+            if (!m_Slot.store(cache))
+            {
+                return nullptr;
+            }
+
+            return cache.get();
+        }
+
+        bool take_capacity() noexcept
+        {
+            auto available = m_Available.load(std::memory_order_relaxed);
+
+            while (available != 0)
+            {
+                if (m_Available.compare_exchange_weak(available, available - 1, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void destroy(Node* node) noexcept
+        {
+            delete node; // NOLINT owned by the pool
+            unreference();
+        }
+
+        void unreference() noexcept
+        {
+            if (m_References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete this; // NOLINT last reference
+            }
+        }
+
+        std::function<void(T&)> m_Reset;
+        std::atomic<std::size_t> m_References = 1;
+        std::atomic<std::size_t> m_Available;
+        std::atomic<bool> m_Orphaned = false;
+        std::atomic_flag m_Lock = ATOMIC_FLAG_INIT;
+        Node* m_Shared = nullptr;
+        ThreadLocalSlot m_Slot;
+    };
+
+    template<class T, class Factory>
+    class PooledInstanceStorage final : private InstanceStorage<T, Factory>
+    {
+        using base = InstanceStorage<T, Factory>;
+
+    public:
+        using value_type = T;
+
+        static constexpr bool is_singleton = false;
+        static constexpr bool resolves_in_owner = true;
+
+        /**
+         * @param capacity maximum number of idle objects kept for reuse
+         * @param reset invoked on each object when it is returned to the pool, must not throw
+         * @param args arguments forwarded to factory
+         */
+        template<class... Args>
+        PooledInstanceStorage(std::size_t capacity, std::function<void(T&)> reset, Args&&... args)
+            : base(std::forward<Args>(args)...),
+              m_Pool(new ObjectPool<T>(capacity, std::move(reset))) // NOLINT freed by the pool itself
+        {
+        }
+
+        PooledInstanceStorage(const PooledInstanceStorage&) = delete;
+        PooledInstanceStorage& operator=(const PooledInstanceStorage&) = delete;
+
+        ~PooledInstanceStorage()
+        {
+            m_Pool->orphan();
+        }
+
+        /**
+         * Hand out idle object from the pool or create new one when there is none.
+         * Object returns to the pool once the last reference to it is released, pool outlives the binding if needed.
+         */
+        std::shared_ptr<T> get(InjectorBase& injector)
+        {
+            auto* node = m_Pool->acquire();
+
+            if (!node)
+            {
+                auto object = base::get(injector);
+
+                if (!object)
+                {
+                    return nullptr;
+                }
+
+                node = m_Pool->adopt(std::move(object));
+            }
+
+            return std::shared_ptr<T>(node->object.get(), Return{node});
+        }
+
+        /**
+         * Pooled objects must be released to be reused, thus they cannot be borrowed.
+         * @return nullptr
+         */
+        T* borrow(InjectorBase& /*injector*/) noexcept
+        {
+            return nullptr;
+        }
+
+    private:
+        using node_type = typename ObjectPool<T>::Node;
+
+        struct Return
+        {
+            node_type* node;
+
+            void operator()(T* /*instance*/) const noexcept
+            {
+                node->pool->release(node);
+            }
+        };
+
+        ObjectPool<T>* m_Pool;
+    };
+} // namespace injector::detail
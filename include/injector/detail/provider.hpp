@@ -1,55 +1,452 @@
 #pragma once
 
+#include <atomic>
+#include <string_view>
+#include <vector>
+
 #include "storage.hpp"
+#include "injector/type_id.hpp"
 
 namespace injector::detail
 {
+    enum class DependencyKind
+    {
+        // std::shared_ptr<T> or T, resolved through single binding
+        Shared,
+        // std::unique_ptr<T>, binding must construct new object on each request
+        Exclusive,
+        // std::vector<T>, resolved through all bindings of the type, which may be none
+        Multiple,
+        // Lazy<T> or Provider<T>, resolved only when used, thus it cannot take part in a cycle
+        Deferred
+    };
+
+    struct DependencyTable;
+
+    struct Dependency
+    {
+        DependencyKind kind;
+        std::size_t type;
+        std::string_view name;
+        // dependencies of the type when it is constructed without binding, nullptr if it cannot be
+        const DependencyTable* (*implicit)() noexcept;
+    };
+
+    // Arguments of the constructor or function that factory invokes
+    struct DependencyTable
+    {
+        // whether factory can create object with arguments injector could provide
+        bool constructible;
+        std::vector<Dependency> arguments;
+    };
+
+    struct DependencyNode
+    {
+        // type_id of type the binding is registered for
+        std::size_t type;
+        std::string_view name;
+        const DependencyTable* dependencies;
+    };
+
+    template<class Factory>
+    struct factory_dependencies;
+
+    template<class Storage>
+    struct storage_factory;
+
+    template<template<class, class, class...> class Storage, class T, class Factory, class... Rest>
+    struct storage_factory<Storage<T, Factory, Rest...>>
+    {
+        using type = Factory;
+    };
+
     class IComponentProvider
     {
     public:
         virtual ~IComponentProvider() = default;
+
+        /**
+         * @return true if provider serves single shared instance which can be created ahead of time
+         */
+        [[nodiscard]] virtual bool is_singleton() const noexcept = 0;
+
+        /**
+         * Create or retrieve instance without handing it out.
+         * @param injector injector used for resolving dependencies
+         * @return false if instance could not be created
+         */
+        virtual bool instantiate(InjectorBase& injector) = 0;
+
+        /**
+         * @return type_id of the type that is constructed directly on each request, 0 if binding does not construct new objects itself
+         */
+        [[nodiscard]] virtual std::size_t constructed_type() const noexcept = 0;
+
+        /**
+         * @return type the binding is registered for together with arguments of its factory
+         */
+        [[nodiscard]] virtual DependencyNode dependency_node() const noexcept = 0;
+
+#if INJECTOR_ENABLE_METRICS
+        /**
+         * @return snapshot of resolution statistics of this binding
+         */
+        [[nodiscard]] virtual BindingMetrics metrics() const noexcept = 0;
+#endif
+
+        /**
+         * @param owner injector that owns the binding, set whenever binding is taken over by another injector
+         */
+        void set_owner(InjectorBase* owner) noexcept
+        {
+            m_Owner = owner;
+        }
+
+        /**
+         * @return injector that owns the binding, nullptr if binding has not been registered yet
+         */
+        [[nodiscard]] InjectorBase* owner() const noexcept
+        {
+            return m_Owner;
+        }
+
+        /**
+         * @return type_tag of the type the binding is registered for, tells apart types whose type_id coincides
+         */
+        [[nodiscard]] const void* type_tag() const noexcept
+        {
+            return m_Tag;
+        }
+
+    protected:
+        explicit IComponentProvider(const void* tag) noexcept
+            : m_Tag(tag)
+        {
+        }
+
+    private:
+        InjectorBase* m_Owner = nullptr;
+        const void* m_Tag;
     };
 
-    template<class T>
-    class ComponentProviderBase : public IComponentProvider
+    class ProviderRange
     {
     public:
-        virtual std::shared_ptr<T> get(Injector& injector) = 0;
+        ProviderRange() noexcept = default;
+
+        ProviderRange(IComponentProvider* const* first, IComponentProvider* const* last) noexcept
+            : m_First(first),
+              m_Last(last)
+        {
+        }
+
+        [[nodiscard]] IComponentProvider* const* begin() const noexcept
+        {
+            return m_First;
+        }
+
+        [[nodiscard]] IComponentProvider* const* end() const noexcept
+        {
+            return m_Last;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return static_cast<std::size_t>(m_Last - m_First);
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_First == m_Last;
+        }
+
+    private:
+        IComponentProvider* const* m_First = nullptr;
+        IComponentProvider* const* m_Last = nullptr;
+    };
+
+    /**
+     * Providers registered for single type in registration order.
+     * Most types have single provider, it is stored inline and providers spill to heap only once there are more.
+     * Last provider is always kept inline, so looking it up does not branch on number of providers.
+     */
+    class ProviderList
+    {
+    public:
+        void push_back(IComponentProvider* provider)
+        {
+            if (m_Last)
+            {
+                if (m_Spilled.empty())
+                {
+                    m_Spilled.push_back(m_Last);
+                }
+
+                m_Spilled.push_back(provider);
+            }
+
+            m_Last = provider;
+        }
+
+        [[nodiscard]] IComponentProvider* back() const noexcept
+        {
+            return m_Last;
+        }
+
+        [[nodiscard]] IComponentProvider* const* data() const noexcept
+        {
+            return m_Spilled.empty() ? &m_Last : m_Spilled.data();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            if (m_Spilled.empty())
+            {
+                return m_Last ? 1 : 0;
+            }
+
+            return m_Spilled.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_Last == nullptr;
+        }
+
+        [[nodiscard]] IComponentProvider* const* begin() const noexcept
+        {
+            return data();
+        }
+
+        [[nodiscard]] IComponentProvider* const* end() const noexcept
+        {
+            return data() + size();
+        }
+
+    private:
+        IComponentProvider* m_Last = nullptr;
+        std::vector<IComponentProvider*> m_Spilled;
     };
 
     template<class T>
-    class NonCastingComponentProvider : public ComponentProviderBase<T>
+    class ComponentProviderBase : public IComponentProvider
     {
     public:
-        explicit NonCastingComponentProvider(std::unique_ptr<InstanceStorage<T>>&& storage)
-            : m_Storage(std::move(storage))
+        ComponentProviderBase() noexcept
+            : IComponentProvider(detail::type_tag<T>())
         {
         }
 
-        std::shared_ptr<T> get(Injector& injector) override
+        virtual std::shared_ptr<T> get(InjectorBase& injector) = 0;
+
+        /**
+         * Retrieve instance without sharing its ownership.
+         * @param injector injector used for resolving dependencies
+         * @return instance owned by the binding or nullptr if binding does not keep its instances
+         */
+        virtual T* borrow(InjectorBase& injector) = 0;
+
+        /**
+         * Create new object owned exclusively by the caller, without shared ownership control block.
+         * @param injector injector used for resolving dependencies
+         * @return created object or nullptr if binding does not construct new objects itself
+         */
+        virtual std::unique_ptr<T> create_unique(InjectorBase& injector) = 0;
+
+        /**
+         * Same as get, but once binding has published its instance it is returned without virtual call.
+         */
+        std::shared_ptr<T> get_fast(InjectorBase& injector)
+        {
+            if (const auto* instance = m_Published.load(std::memory_order_acquire))
+            {
+                return *instance;
+            }
+
+            return get(injector);
+        }
+
+        /**
+         * Same as borrow, but once binding has published its instance it is returned without virtual call.
+         */
+        T* borrow_fast(InjectorBase& injector)
+        {
+            if (const auto* instance = m_Published.load(std::memory_order_acquire))
+            {
+                return instance->get();
+            }
+
+            return borrow(injector);
+        }
+
+    protected:
+        /**
+         * Publish instance that binding hands out for as long as it exists.
+         * @param instance instance kept by storage of the binding, nullptr if it has not been created yet
+         */
+        void publish(const std::shared_ptr<T>* instance) noexcept
         {
-            return m_Storage->get(injector);
+            if (instance && !m_Published.load(std::memory_order_relaxed))
+            {
+                m_Published.store(instance, std::memory_order_release);
+            }
         }
 
     private:
-        std::unique_ptr<InstanceStorage<T>> m_Storage;
+        // serves as dispatch tag, lookups only go through virtual call until instance is published
+        std::atomic<const std::shared_ptr<T>*> m_Published = nullptr;
     };
 
-    template<class Base, class Derived>
-    class CastingComponentProvider : public ComponentProviderBase<Base>
+    /**
+     * Downcast provider found under type_id of T, identifiers are hashes thus provider may be registered for another type.
+     * @return provider of T, nullptr after raising KeyCollision if provider is registered for another type
+     */
+    template<class T>
+    ComponentProviderBase<T>* provider_cast(IComponentProvider* provider)
+    {
+        if (provider->type_tag() != type_tag<T>())
+        {
+            raise({ErrorCode::KeyCollision, type_id<T>()});
+            return nullptr;
+        }
+
+        return static_cast<ComponentProviderBase<T>*>(provider);
+    }
+
+    /**
+     * Single allocation binding that owns its storage and factory by value.
+     * Resolution costs one virtual call, storage and factory calls are resolved at compile time.
+     * Bindings whose storage keeps the same instance for as long as it exists publish it once it is created,
+     * after that lookups through get_fast and borrow_fast read it without any virtual call.
+     * Storages whose instances outlive resolution that created them resolve dependencies in injector owning the binding,
+     * so their objects never capture scope or child injector that happened to request them first.
+     * @tparam Base type the binding is registered for
+     * @tparam Storage storage policy holding factory of type derived from Base
+     */
+    template<class Base, class Storage>
+    class ComponentProvider final : public ComponentProviderBase<Base>
     {
+        using value_type = typename Storage::value_type;
+
+        static constexpr bool is_transient_constructor = std::is_same_v<Storage, InstanceStorage<value_type, ConstructorFactory<value_type>>>;
+
+        // published instance would bypass resolution counters
+        static constexpr bool publishes_instance = has_stable_instance_v<Storage, Base> && !INJECTOR_ENABLE_METRICS;
+
     public:
-        explicit CastingComponentProvider(std::unique_ptr<InstanceStorage<Derived>>&& storage)
-            : m_Storage(std::move(storage))
+        template<class... Args>
+        explicit ComponentProvider(Args&&... args)
+            : m_Storage(std::forward<Args>(args)...)
+        {
+            if constexpr (publishes_instance)
+            {
+                this->publish(m_Storage.instance());
+            }
+        }
+
+        std::shared_ptr<Base> get(InjectorBase& injector) override
+        {
+#if INJECTOR_ENABLE_METRICS
+            ActiveBindingGuard guard(m_Counters, s_Binding);
+#endif
+            auto value = m_Storage.get(context(injector));
+
+            if constexpr (publishes_instance)
+            {
+                this->publish(m_Storage.instance());
+            }
+
+            return value;
+        }
+
+        Base* borrow(InjectorBase& injector) override
         {
+#if INJECTOR_ENABLE_METRICS
+            ActiveBindingGuard guard(m_Counters, s_Binding);
+#endif
+            auto* instance = m_Storage.borrow(context(injector));
+
+            if constexpr (publishes_instance)
+            {
+                this->publish(m_Storage.instance());
+            }
+
+            return instance;
         }
 
-        std::shared_ptr<Base> get(Injector& injector) override
+        [[nodiscard]] bool is_singleton() const noexcept override
         {
-            return std::static_pointer_cast<Base>(m_Storage->get(injector));
+            return Storage::is_singleton;
         }
 
+        bool instantiate(InjectorBase& injector) override
+        {
+#if INJECTOR_ENABLE_METRICS
+            ActiveBindingGuard guard(m_Counters, s_Binding);
+#endif
+            const bool created = m_Storage.get(context(injector)) != nullptr;
+
+            if constexpr (publishes_instance)
+            {
+                this->publish(m_Storage.instance());
+            }
+
+            return created;
+        }
+
+        std::unique_ptr<Base> create_unique(InjectorBase& injector) override
+        {
+            if constexpr (is_transient_constructor)
+            {
+#if INJECTOR_ENABLE_METRICS
+                ActiveBindingGuard guard(m_Counters, s_Binding);
+#endif
+
+                return m_Storage.create_unique(injector);
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        [[nodiscard]] std::size_t constructed_type() const noexcept override
+        {
+            return is_transient_constructor ? type_id<value_type>() : 0;
+        }
+
+        [[nodiscard]] DependencyNode dependency_node() const noexcept override
+        {
+            return {type_id<Base>(), type_name<Base>(), factory_dependencies<typename storage_factory<Storage>::type>::get()};
+        }
+
+#if INJECTOR_ENABLE_METRICS
+        [[nodiscard]] BindingMetrics metrics() const noexcept override
+        {
+            return m_Counters.snapshot(s_Binding);
+        }
+#endif
+
     private:
-        std::unique_ptr<InstanceStorage<Derived>> m_Storage;
+        [[nodiscard]] InjectorBase& context(InjectorBase& injector) const noexcept
+        {
+            if constexpr (Storage::resolves_in_owner)
+            {
+                if (auto* owner = this->owner())
+                {
+                    return *owner;
+                }
+            }
+
+            return injector;
+        }
+
+        Storage m_Storage;
+
+#if INJECTOR_ENABLE_METRICS
+        static constexpr BindingInfo s_Binding{type_id<Base>(), type_name<Base>(), type_name<value_type>()};
+
+        BindingCounters m_Counters;
+#endif
     };
 } // namespace injector::detail
\ No newline at end of file
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <limits>
+
+#include "injector/injector_base.hpp"
+
+namespace injector::detail
+{
+    class PlanEntry
+    {
+    public:
+        virtual ~PlanEntry() = default;
+    };
+
+    /**
+     * Providers used for each constructor argument of one factory type, in construction order, as valid for single injector.
+     * Plan is compiled during first resolution and reused until registrations of the injector change,
+     * so warm resolutions of whole dependency graph do not perform any registration lookups.
+     * Providers are read and written as a whole under sequence lock, thus reader never mixes providers of different compilations.
+     * @tparam N number of constructor arguments
+     */
+    template<std::size_t N>
+    class ResolutionPlan final : public PlanEntry
+    {
+    public:
+        using providers_type = std::array<IComponentProvider*, N>;
+
+        /**
+         * Copy providers out of the plan.
+         * @param generation current generation of resolving injector
+         * @param providers receives cached providers
+         * @return true if plan was compiled for given generation and providers were copied consistently
+         */
+        bool load(std::size_t generation, providers_type& providers) const noexcept
+        {
+            const auto version = m_Generation.load(std::memory_order_acquire);
+
+            if (version != generation)
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                providers[i] = m_Slots[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return m_Generation.load(std::memory_order_relaxed) == version;
+        }
+
+        /**
+         * Replace cached providers, skipped when another thread is storing at the same time.
+         * @param generation generation of resolving injector providers were looked up in
+         * @param providers providers of each constructor argument
+         */
+        void store(std::size_t generation, const providers_type& providers) noexcept
+        {
+            auto version = m_Generation.load(std::memory_order_relaxed);
+
+            if (version == generation || version == writing || !m_Generation.compare_exchange_strong(version, writing, std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                m_Slots[i].store(providers[i], std::memory_order_relaxed);
+            }
+
+            m_Generation.store(generation, std::memory_order_release);
+        }
+
+    private:
+        static constexpr std::size_t writing = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t not_compiled = writing - 1;
+
+        std::array<std::atomic<IComponentProvider*>, N> m_Slots{};
+        std::atomic<std::size_t> m_Generation = not_compiled;
+    };
+
+    /**
+     * Resolution plans compiled against single injector, indexed by factory type.
+     * Plans are created on first use and kept until the cache is destroyed, their number is bounded by number
+     * of factory types, therefore resolving through many injectors never makes them compete for the same plan.
+     */
+    class PlanCache
+    {
+    public:
+        PlanCache() = default;
+
+        PlanCache(const PlanCache&) = delete;
+        PlanCache& operator=(const PlanCache&) = delete;
+
+        PlanCache(PlanCache&& other) noexcept;
+        PlanCache& operator=(PlanCache&& other) noexcept;
+
+        ~PlanCache();
+
+        /**
+         * @param index index of factory type obtained from plan_index
+         * @return plan of given factory type, nullptr if there are more factory types than cache can hold
+         */
+        template<std::size_t N>
+        ResolutionPlan<N>* find(std::size_t index)
+        {
+            if (index >= chunk_count * chunk_size)
+            {
+                return nullptr;
+            }
+
+            auto& entry = chunk(index / chunk_size).entries[index % chunk_size];
+            auto* plan = entry.load(std::memory_order_acquire);
+
+            if (!plan)
+            {
+                auto created = std::make_unique<ResolutionPlan<N>>();
+
+                if (entry.compare_exchange_strong(plan, created.get(), std::memory_order_acq_rel))
+                {
+                    plan = created.release();
+                }
+            }
+
+            return static_cast<ResolutionPlan<N>*>(plan);
+        }
+
+    private:
+        static constexpr std::size_t chunk_size = 64;
+        static constexpr std::size_t chunk_count = 64;
+
+        struct Chunk
+        {
+            std::array<std::atomic<PlanEntry*>, chunk_size> entries{};
+        };
+
+        Chunk& chunk(std::size_t index);
+
+        void clear() noexcept;
+
+        std::array<std::atomic<Chunk*>, chunk_count> m_Chunks{};
+    };
+
+    std::size_t next_plan_index() noexcept;
+
+    // Dense index of given factory type, plans of the same factory type are identical for the same injector
+    template<class Factory>
+    std::size_t plan_index() noexcept
+    {
+        static const std::size_t index = next_plan_index();
+        return index;
+    }
+
+    /**
+     * Providers of constructor arguments for single resolution of given factory type.
+     * They are copied from plan of resolving injector when it is compiled, otherwise they are looked up
+     * by argument resolvers and stored into the plan by commit.
+     * @tparam Factory factory type the plan belongs to
+     * @tparam N number of constructor arguments
+     */
+    template<class Factory, std::size_t N>
+    class PlannedArguments
+    {
+    public:
+        explicit PlannedArguments(InjectorBase& injector)
+            : m_Generation(injector.generation())
+        {
+            if (auto* plans = injector.plans())
+            {
+                m_Plan = plans->template find<N>(plan_index<Factory>());
+                m_Compiled = m_Plan && m_Plan->load(m_Generation, m_Providers);
+            }
+        }
+
+        [[nodiscard]] bool compiled() const noexcept
+        {
+            return m_Compiled;
+        }
+
+        [[nodiscard]] IComponentProvider*& provider(std::size_t index) noexcept
+        {
+            return m_Providers[index];
+        }
+
+#if !INJECTOR_HAS_EXCEPTIONS
+        /**
+         * While exceptions are disabled, failed arguments reach the constructor as nullptr, therefore
+         * dependency graph is checked before creating any argument. Compiled plan proves the arguments were
+         * already resolved in current generation, and without active error sink any failure aborts regardless.
+         * @return true if constructor may be invoked, otherwise failure has been recorded into active sink
+         */
+        [[nodiscard]] bool resolvable(InjectorBase& injector) const
+        {
+            return m_Compiled || !current_error_sink() || injector.check_dependencies(factory_dependencies<Factory>::get());
+        }
+#endif
+
+        // Store looked up providers into the plan, must only be called once every argument has been resolved
+        void commit() noexcept
+        {
+            if (m_Plan && !m_Compiled)
+            {
+                m_Plan->store(m_Generation, m_Providers);
+            }
+        }
+
+    private:
+        std::size_t m_Generation;
+        ResolutionPlan<N>* m_Plan = nullptr;
+        bool m_Compiled = false;
+        typename ResolutionPlan<N>::providers_type m_Providers{};
+    };
+} // namespace injector::detail
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "injector/scope.hpp"
+
+namespace injector::detail
+{
+    template<class T, class Factory>
+    class ScopedInstanceStorage final : private InstanceStorage<T, Factory>
+    {
+        using base = InstanceStorage<T, Factory>;
+
+    public:
+        using value_type = T;
+
+        static constexpr bool is_singleton = false;
+        static constexpr bool resolves_in_owner = false;
+
+        template<class... Args>
+        explicit ScopedInstanceStorage(Args&&... args)
+            : base(std::forward<Args>(args)...)
+        {
+        }
+
+        /**
+         * Instance is created once per scope, resolving outside of any scope yields nullptr.
+         */
+        std::shared_ptr<T> get(InjectorBase& injector)
+        {
+            auto* scope = injector.scope();
+
+            if (!scope)
+            {
+                return nullptr;
+            }
+
+            return scope->get_or_create<T>(this, [this](InjectorBase& scope_injector) {
+                return base::get(scope_injector);
+            });
+        }
+
+        /**
+         * @return pointer to instance that stays valid for as long as resolving scope exists, nullptr outside of any scope
+         */
+        T* borrow(InjectorBase& injector)
+        {
+            return get(injector).get();
+        }
+    };
+} // namespace injector::detail
@@ -1,49 +1,189 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
+#include "injector/metrics.hpp"
+#include "injector/trace.hpp"
+#include "injector/type_id.hpp"
 #include "injector/detail/factory.hpp"
 
 namespace injector::detail
 {
-    template<class T>
+    template<class T, class Factory>
     class InstanceStorage
     {
     public:
-        explicit InstanceStorage(std::unique_ptr<ComponentFactory<T>>&& factory)
-            : m_Factory(std::move(factory))
+        using value_type = T;
+
+        static constexpr bool is_singleton = false;
+        // whether instances outlive resolution that created them, their dependencies are then resolved in injector owning the binding
+        static constexpr bool resolves_in_owner = false;
+
+        template<class... Args>
+        explicit InstanceStorage(Args&&... args)
+            : m_Factory(std::forward<Args>(args)...)
         {
         }
 
-        virtual std::shared_ptr<T> get(Injector& injector)
+        std::shared_ptr<T> get(InjectorBase& injector)
         {
-            return m_Factory->build(injector);
+            if constexpr (is_constant_factory_v<Factory>)
+            {
+                return m_Factory.build(injector);
+            }
+            else
+            {
+                return construct([&] {
+                    return m_Factory.build(injector);
+                });
+            }
+        }
+
+        /**
+         * Create object without shared ownership, only available for bindings that construct objects directly.
+         */
+        std::unique_ptr<T> create_unique(InjectorBase& injector)
+        {
+            static_assert(is_constructor_factory_v<Factory>, "Objects of given binding cannot be owned exclusively");
+
+            return construct([&] {
+                return m_Factory.build_unique(injector);
+            });
+        }
+
+        /**
+         * Only constant bindings hand out the same object on each request, transient objects cannot be borrowed.
+         * @return pointer to constant object or nullptr
+         */
+        T* borrow(InjectorBase& /*injector*/) noexcept
+        {
+            if constexpr (is_constant_factory_v<Factory>)
+            {
+                return m_Factory.data();
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        /**
+         * Only available for constant bindings.
+         * @return constant object as it is handed out
+         */
+        [[nodiscard]] auto instance() const noexcept
+        {
+            static_assert(is_constant_factory_v<Factory>, "Only constant bindings keep their object");
+
+            return &m_Factory.instance();
         }
 
     private:
-        std::unique_ptr<ComponentFactory<T>> m_Factory;
+        // Every newly created object passes through here, so it can be traced and measured
+        template<class Create>
+        auto construct(Create&& create)
+        {
+            TraceSpan span(type_name<T>());
+
+#if INJECTOR_ENABLE_METRICS
+            return record_construction(std::forward<Create>(create));
+#else
+            return create();
+#endif
+        }
+
+        Factory m_Factory;
     };
 
-    template<class T>
-    class SingletonInstanceStorage : public InstanceStorage<T>
+    /**
+     * @tparam T type of the object
+     * @tparam Factory factory creating the object
+     * @tparam Interface type instance is kept and handed out as, base of T the binding is registered for
+     */
+    template<class T, class Factory, class Interface = T>
+    class SingletonInstanceStorage final : private InstanceStorage<T, Factory>
     {
-        using base = InstanceStorage<T>;
+        using base = InstanceStorage<T, Factory>;
 
     public:
-        explicit SingletonInstanceStorage(std::unique_ptr<ComponentFactory<T>>&& factory)
-            : base(std::move(factory))
+        using value_type = T;
+        using interface_type = Interface;
+
+        static constexpr bool is_singleton = true;
+        static constexpr bool resolves_in_owner = true;
+
+        template<class... Args>
+        explicit SingletonInstanceStorage(Args&&... args)
+            : base(std::forward<Args>(args)...)
         {
         }
 
-        std::shared_ptr<T> get(Injector& injector) override
+        /**
+         * Safe to call from multiple threads, instance is created exactly once.
+         * Once created, retrieval only performs single acquire load without taking any locks.
+         */
+        std::shared_ptr<Interface> get(InjectorBase& injector)
         {
-            if (!m_Instance)
+            if (!m_Initialized.load(std::memory_order_acquire))
             {
-                m_Instance = base::get(injector);
+                initialize(injector);
             }
 
             return m_Instance;
         }
 
+        /**
+         * Same as get, but without touching reference count of the instance.
+         * @return pointer to singleton instance that stays valid for as long as the storage exists, nullptr if creation failed
+         */
+        Interface* borrow(InjectorBase& injector)
+        {
+            if (!m_Initialized.load(std::memory_order_acquire))
+            {
+                initialize(injector);
+            }
+
+            return m_Instance.get();
+        }
+
+        /**
+         * @return instance that stays the same for as long as the storage exists, nullptr if it has not been created yet
+         */
+        [[nodiscard]] const std::shared_ptr<Interface>* instance() const noexcept
+        {
+            return m_Initialized.load(std::memory_order_acquire) ? &m_Instance : nullptr;
+        }
+
     private:
-        std::shared_ptr<T> m_Instance;
+        void initialize(InjectorBase& injector)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            if (!m_Initialized.load(std::memory_order_relaxed))
+            {
+                m_Instance = base::get(injector);
+
+                // failed creation is not cached, next retrieval will try again
+                m_Initialized.store(m_Instance != nullptr, std::memory_order_release);
+            }
+        }
+
+        std::shared_ptr<Interface> m_Instance;
+        std::atomic<bool> m_Initialized = false;
+        std::mutex m_Mutex;
     };
-} // namespace injector::detail
\ No newline at end of file
+
+    // Whether storage keeps the same instance of Interface type for as long as it exists once the instance has been created
+    template<class Storage, class Interface>
+    struct has_stable_instance : std::false_type {};
+
+    template<class T, class Factory, class Interface>
+    struct has_stable_instance<SingletonInstanceStorage<T, Factory, Interface>, Interface> : std::true_type {};
+
+    template<class T, class Interface>
+    struct has_stable_instance<InstanceStorage<T, ConstantFactory<T, Interface>>, Interface> : std::true_type {};
+
+    template<class Storage, class Interface>
+    constexpr bool has_stable_instance_v = has_stable_instance<Storage, Interface>::value;
+} // namespace injector::detail
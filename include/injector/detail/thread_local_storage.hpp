@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "injector/detail/storage.hpp"
+
+namespace injector::detail
+{
+    // Instance kept by thread local binding for current thread
+    struct ThreadLocalCell
+    {
+        std::uint64_t version = 0;
+        std::shared_ptr<void> instance;
+    };
+
+    // Trivially destructible, thus it can still be read while other thread local objects are destroyed
+    inline bool& thread_local_cells_destroyed() noexcept
+    {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    struct ThreadLocalCells
+    {
+        ThreadLocalCells() = default;
+
+        ThreadLocalCells(const ThreadLocalCells&) = delete;
+        ThreadLocalCells& operator=(const ThreadLocalCells&) = delete;
+
+        // instances destroyed together with the cells may release objects that would look the cells up again
+        ~ThreadLocalCells()
+        {
+            thread_local_cells_destroyed() = true;
+        }
+
+        std::vector<ThreadLocalCell> cells;
+    };
+
+    /**
+     * @return cells of current thread, nullptr once the thread has started destroying them on exit
+     */
+    inline std::vector<ThreadLocalCell>* thread_local_cells() noexcept
+    {
+        if (thread_local_cells_destroyed())
+        {
+            return nullptr;
+        }
+
+        static thread_local ThreadLocalCells cells;
+        return &cells.cells;
+    }
+
+    /**
+     * Index into per-thread cells reserved for a single binding.
+     * Indices are reused once released, cells left behind by released slot are recognised by their version
+     * and replaced on next use, until then their instances stay alive together with the thread.
+     */
+    class ThreadLocalSlot
+    {
+    public:
+        ThreadLocalSlot();
+
+        ThreadLocalSlot(const ThreadLocalSlot&) = delete;
+        ThreadLocalSlot& operator=(const ThreadLocalSlot&) = delete;
+
+        ~ThreadLocalSlot();
+
+        /**
+         * Give index back ahead of destruction, following slots may reuse it and replace cells stored through this one.
+         * Cells of this slot are still found until they are replaced. Must be called at most once.
+         */
+        void release();
+
+        /**
+         * @return cell of current thread that belongs to this slot, nullptr if current thread has not filled it yet
+         */
+        [[nodiscard]] ThreadLocalCell* find() const noexcept
+        {
+            auto* cells = thread_local_cells();
+
+            if (cells && m_Index < cells->size() && (*cells)[m_Index].version == m_Version)
+            {
+                return &(*cells)[m_Index];
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Store instance for current thread.
+         * @param instance instance to keep until the thread exits
+         * @return false if current thread is already destroying its cells, instance is not kept then
+         */
+        bool store(std::shared_ptr<void> instance) const;
+
+    private:
+        std::size_t m_Index;
+        std::uint64_t m_Version;
+        bool m_Released = false;
+    };
+
+    template<class T, class Factory>
+    class ThreadLocalInstanceStorage final : private InstanceStorage<T, Factory>
+    {
+        using base = InstanceStorage<T, Factory>;
+
+    public:
+        using value_type = T;
+
+        static constexpr bool is_singleton = false;
+        static constexpr bool resolves_in_owner = true;
+
+        template<class... Args>
+        explicit ThreadLocalInstanceStorage(Args&&... args)
+            : base(std::forward<Args>(args)...)
+        {
+        }
+
+        /**
+         * Instance is created once per thread on its first retrieval request.
+         * Afterwards retrieval only reads thread local data, no memory is shared with other threads.
+         */
+        std::shared_ptr<T> get(InjectorBase& injector)
+        {
+            if (auto* cell = m_Slot.find())
+            {
+                return std::static_pointer_cast<T>(cell->instance);
+            }
+
+            auto instance = base::get(injector);
+
+            // failed creation is not cached, next retrieval will try again
+            if (instance)
+            {
+                m_Slot.store(instance);
+            }
+
+            return instance;
+        }
+
+        /**
+         * @return pointer to instance of current thread that stays valid until the thread exits, nullptr if creation failed
+         */
+        T* borrow(InjectorBase& injector)
+        {
+            if (auto* cell = m_Slot.find())
+            {
+                return static_cast<T*>(cell->instance.get());
+            }
+
+            return get(injector).get();
+        }
+
+    private:
+        ThreadLocalSlot m_Slot;
+    };
+} // namespace injector::detail
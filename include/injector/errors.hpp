@@ -1,9 +1,53 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdlib>
 #include <exception>
+#include <string_view>
+#include <vector>
+
+// Library and every translation unit using it must be built with the same setting, inline functions and templates
+// differ between the two modes, thus mixing them violates the one definition rule
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define INJECTOR_HAS_EXCEPTIONS 1
+#else
+    #define INJECTOR_HAS_EXCEPTIONS 0
+#endif
 
 namespace injector
 {
+    enum class ErrorCode
+    {
+        // Type has no binding and none of its constructors can be satisfied by the injector
+        Unbound,
+        // Binding or factory did not produce an object
+        CreationFailed,
+        // Binding does not keep its object, thus it cannot be borrowed
+        NotBorrowable,
+        // Binding does not construct new object on each request, thus its object cannot be owned exclusively
+        NotTransient,
+        // Type depends on itself through its dependencies
+        Cycle,
+        // Keyed binding shares registration identifier with binding of another type
+        KeyCollision
+    };
+
+    struct ResolutionError
+    {
+        ErrorCode code;
+        // type_id of the innermost type that failed to resolve, it may be a dependency of requested type
+        std::size_t type;
+    };
+
+    struct ValidationError
+    {
+        ErrorCode code;
+        // type_id of the type that cannot be resolved
+        std::size_t type;
+        // names of types leading from validated binding to the type that cannot be resolved, inclusive
+        std::vector<std::string_view> path;
+    };
+
     class InjectorException : public std::exception
     {
     };
@@ -11,6 +55,105 @@ namespace injector
     class ComponentCreationException : public InjectorException
     {
     public:
+        ComponentCreationException() noexcept = default;
+
+        explicit ComponentCreationException(const ResolutionError& error) noexcept
+            : m_Error(error)
+        {
+        }
+
         [[nodiscard]] const char* what() const noexcept override;
+
+        [[nodiscard]] const ResolutionError& error() const noexcept
+        {
+            return m_Error;
+        }
+
+    private:
+        ResolutionError m_Error{ErrorCode::CreationFailed, 0};
     };
-} // namespace injector
\ No newline at end of file
+
+    namespace detail
+    {
+        /**
+         * Collects resolution failures of current thread while exceptions are disabled.
+         * Only the first failure is kept, which is the innermost one since dependencies are resolved before dependants.
+         */
+        struct ErrorSink
+        {
+            ResolutionError error{ErrorCode::CreationFailed, 0};
+            std::size_t failures = 0;
+        };
+
+        inline ErrorSink*& current_error_sink() noexcept
+        {
+            static thread_local ErrorSink* sink = nullptr;
+            return sink;
+        }
+
+        // Makes given sink active on current thread for the lifetime of the guard
+        class ErrorSinkGuard
+        {
+        public:
+            explicit ErrorSinkGuard(ErrorSink& sink) noexcept
+                : m_Previous(current_error_sink())
+            {
+                current_error_sink() = &sink;
+            }
+
+            ErrorSinkGuard(const ErrorSinkGuard&) = delete;
+            ErrorSinkGuard& operator=(const ErrorSinkGuard&) = delete;
+
+            ~ErrorSinkGuard()
+            {
+                current_error_sink() = m_Previous;
+            }
+
+        private:
+            ErrorSink* m_Previous;
+        };
+
+        /**
+         * Report failed resolution.
+         * Throws ComponentCreationException, when exceptions are disabled records error into active sink instead and returns,
+         * letting the caller unwind by returning nullptr. Without active sink the program is aborted.
+         * @param error failure description
+         */
+        inline void raise(const ResolutionError& error)
+        {
+#if INJECTOR_HAS_EXCEPTIONS
+            throw ComponentCreationException(error);
+#else
+            auto* sink = current_error_sink();
+
+            if (!sink)
+            {
+                std::abort();
+            }
+
+            if (sink->failures++ == 0)
+            {
+                sink->error = error;
+            }
+#endif
+        }
+
+        // Same as raise, for callers that cannot return without an object
+        [[noreturn]] inline void raise_unrecoverable(const ResolutionError& error)
+        {
+            raise(error);
+            std::abort();
+        }
+
+        // Number of failures reported on current thread, always zero when exceptions are enabled
+        inline std::size_t failure_count() noexcept
+        {
+#if INJECTOR_HAS_EXCEPTIONS
+            return 0;
+#else
+            auto* sink = current_error_sink();
+            return sink ? sink->failures : 0;
+#endif
+        }
+    } // namespace detail
+} // namespace injector
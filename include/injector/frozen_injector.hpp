@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+
+#include "injector.hpp"
+
+namespace injector
+{
+    /**
+     * Immutable injector produced from configured Injector.
+     * Registrations are kept in flat open addressing table built while freezing. Table is sized to at least
+     * twice the number of registered types, so lookup probes about one and a half adjacent slots on average
+     * and table size stays linear in the number of types regardless of their ids.
+     * No bindings can be added after freezing.
+     */
+    class FrozenInjector final : public InjectorBase
+    {
+    public:
+        /**
+         * Take over all registrations of given injector.
+         * @param injector configured injector, it is left without any registrations
+         */
+        explicit FrozenInjector(Injector&& injector);
+
+        FrozenInjector(const FrozenInjector&) = delete;
+
+        // bindings taken over from other injector resolve their dependencies in this one afterwards, other injector is left empty.
+        // Handles kept by objects created before the move still refer to the other injector
+        FrozenInjector(FrozenInjector&& other);
+
+        FrozenInjector& operator=(const FrozenInjector&) = delete;
+
+        FrozenInjector& operator=(FrozenInjector&& other);
+
+        ~FrozenInjector() override = default;
+
+        [[nodiscard]] detail::PlanCache* plans() noexcept override
+        {
+            return &m_Plans;
+        }
+
+    protected:
+        [[nodiscard]] IComponentProvider* find_provider(std::size_t id) const noexcept override
+        {
+            return find(id).provider;
+        }
+
+        [[nodiscard]] ProviderRange find_providers(std::size_t id) const noexcept override
+        {
+            const auto& slot = find(id);
+            const auto* first = m_Index.data() + slot.first;
+
+            return {first, first + slot.count};
+        }
+
+        [[nodiscard]] std::vector<IComponentProvider*> registered_providers() const override
+        {
+            return m_Index;
+        }
+
+    private:
+        struct Slot
+        {
+            std::size_t id = 0;
+            IComponentProvider* provider = nullptr;
+            std::uint32_t first = 0;
+            std::uint32_t count = 0;
+        };
+
+        // Empty table with at least twice as many slots as given number of keys
+        void allocate(std::size_t keys);
+
+        // Point every provider to this injector as its owner
+        void adopt_providers() noexcept;
+
+        // Fibonacci hashing, top bits of the product select the first probed slot
+        [[nodiscard]] std::size_t slot_index(std::size_t id) const noexcept
+        {
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(id) * 11400714819323198485ULL) >> m_Shift); // NOLINT magic number
+        }
+
+        // Linear probing, table is at most half full thus every probe sequence ends at an empty slot
+        [[nodiscard]] const Slot& find(std::size_t id) const noexcept
+        {
+            for (auto index = slot_index(id);; index = (index + 1) & m_Mask)
+            {
+                const auto& slot = m_Slots[index];
+
+                if (!slot.provider || slot.id == id)
+                {
+                    return slot;
+                }
+            }
+        }
+
+        std::vector<Slot> m_Slots;
+        unsigned m_Shift = 64;
+        std::size_t m_Mask = 0;
+        std::vector<IComponentProvider*> m_Index;
+        std::vector<std::unique_ptr<IComponentProvider>> m_Providers;
+        detail::PlanCache m_Plans;
+    };
+} // namespace injector
@@ -2,419 +2,175 @@
 
 #include <unordered_map>
 
-#include "errors.hpp"
-#include "traits.hpp"
-#include "type_id.hpp"
-#include "injector/detail/provider.hpp"
+#include "module.hpp"
 
 namespace injector
 {
-    using detail::ConstantFactory;
-    using detail::FunctionFactory;
-    using detail::ConstructorFactory;
+    class FrozenInjector;
 
-    using detail::InstanceStorage;
-    using detail::SingletonInstanceStorage;
-
-    using detail::IComponentProvider;
-    using detail::ComponentProviderBase;
-    using detail::CastingComponentProvider;
-    using detail::NonCastingComponentProvider;
-
-    class Injector
+    class Injector : public InjectorBase, public Registrar<Injector>
     {
     public:
-        /**
-         * Add binding to given type.
-         * With this binding given type object will be constructed on each retrieval request.
-         * @tparam T target for binding
-         */
-        template<class T>
-        void add()
-        {
-            auto factory = std::make_unique<ConstructorFactory<T>>();
-            auto storage = std::make_unique<InstanceStorage<T>>(std::move(factory));
+        Injector() = default;
 
-            add_registration<T>(std::move(storage));
-        }
+        Injector(const Injector&) = delete;
 
-        /**
-         * Try add binding to given type.
-         * This method only adds given type if it has not already been added.
-         * With this binding given type object will be constructed on each retrieval request.
-         * @tparam T target for binding
-         * @see add
-         */
-        template<class T>
-        void try_add()
-        {
-            if (!contains<T>())
-            {
-                add<T>();
-            }
-        }
+        // bindings taken over from other injector resolve their dependencies in this one afterwards
+        Injector(Injector&& other);
 
-        /**
-         * Add binding from Base to Derived type.
-         * With this binding given type object will be constructed on each retrieval request.
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         */
-        template<class Base, class Derived>
-        void add()
-        {
-            auto factory = std::make_unique<ConstructorFactory<Derived>>();
-            auto storage = std::make_unique<InstanceStorage<Derived>>(std::move(factory));
+        Injector& operator=(const Injector&) = delete;
 
-            add_registration<Base, Derived>(std::move(storage));
-        }
+        Injector& operator=(Injector&& other);
 
-        /**
-         * Try to add binding from Base to Derived type.
-         * This method only adds given binding if Base has not already been added.
-         * With this binding given type object will be constructed on each retrieval request.
-         * @tparam Base base type on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @see add
-         */
-        template<class Base, class Derived>
-        void try_add()
-        {
-            if (!contains<Base>())
-            {
-                add<Base, Derived>();
-            }
-        }
+        ~Injector() override = default;
 
         /**
-         * Add binding to given type in singleton scope (each request to given type will produce same object).
-         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
-         * @tparam T target for binding
+         * Add bindings of given modules as if they were added one by one in the same order.
+         * Storage is reserved once for the whole batch and each binding costs single lookup,
+         * without publishing each binding separately as add calls do.
+         * Modules are left without any bindings.
+         * @param modules modules deriving from Module
          */
-        template<class T>
-        void add_singleton()
+        template<class... Modules>
+        void install(Modules&&... modules)
         {
-            auto factory = std::make_unique<ConstructorFactory<T>>();
-            auto storage = std::make_unique<SingletonInstanceStorage<T>>(std::move(factory));
+            static_assert((std::is_base_of_v<Module, std::remove_reference_t<Modules>> && ...), "Only modules can be installed");
 
-            add_registration<T>(std::move(storage));
-        }
+            detail::PendingRegistrations registrations;
 
-        /**
-         * Try to add binding to given type in singleton scope (each request to given type will produce same object).
-         * This method only adds given type if it has not already been added.
-         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
-         * @tparam T target for binding
-         * @seem add_singleton
-         */
-        template<class T>
-        void try_add_singleton()
-        {
-            if (!contains<T>())
-            {
-                add_singleton<T>();
-            }
-        }
+            // bindings of the first module are taken over without copying
+            auto take = [&registrations](Module& module) {
+                if (registrations.size() == 0)
+                {
+                    std::swap(registrations, module.m_Registrations);
+                }
+                else
+                {
+                    registrations.append(std::move(module.m_Registrations));
+                }
+            };
 
-        /**
-         * Add binding from Base to Derived type in singleton scope (each request to Base type will produce same Derived instance object).
-         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived Derived actual type that will be constructed when requesting Base type
-         */
-        template<class Base, class Derived>
-        void add_singleton()
-        {
-            auto factory = std::make_unique<ConstructorFactory<Derived>>();
-            auto storage = std::make_unique<SingletonInstanceStorage<Derived>>(std::move(factory));
+            (take(modules), ...);
 
-            add_registration<Base, Derived>(std::move(storage));
+            add_providers(std::move(registrations));
+            increment_generation();
         }
 
         /**
-         * Try to add binding from Base to Derived type in singleton scope (each request to Base type will produce same Derived instance object).
-         * This method only adds given binding if Base type has not already been added.
-         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived Derived actual type that will be constructed when requesting Base type
+         * Move all registrations into immutable injector with dense lookup table.
+         * This injector is left without any registrations.
+         * @return frozen injector serving same bindings
+         * @see FrozenInjector
          */
-        template<class Base, class Derived>
-        void try_add_singleton()
-        {
-            if (!contains<Base>())
-            {
-                add_singleton<Base, Derived>();
-            }
-        }
+        [[nodiscard]] FrozenInjector freeze();
 
-        /**
-         * Add binding to given type with function for instance retrieval.
-         * With this binding given function will be invoked on each retrieval request
-         * @tparam T target for binding
-         * @param fn function to invoke when creating given type object
-         */
-        template<class T>
-        void add(const std::function<std::shared_ptr<T>()>& fn) // NOLINT short name
+        [[nodiscard]] detail::PlanCache* plans() noexcept override
         {
-            auto factory = std::make_unique<FunctionFactory<T>>(fn);
-            auto storage = std::make_unique<InstanceStorage<T>>(std::move(factory));
-
-            add_registration<T>(std::move(storage));
+            return &m_Plans;
         }
 
-        /**
-         * Try add binding to given type with function for instance retrieval.
-         * This method only adds binding if type has not already been added.
-         * With this binding given function will be invoked on each retrieval request
-         * @tparam T target for binding
-         * @param fn function to invoke when creating given type object
-         */
-        template<class T>
-        void try_add(const std::function<std::shared_ptr<T>()>& fn) // NOLINT short name
+    protected:
+        [[nodiscard]] IComponentProvider* find_provider(std::size_t id) const noexcept override
         {
-            if (!contains<T>())
-            {
-                add<T>(fn);
-            }
+            auto it = m_Registrations.find(id); // NOLINT short name
+            return it != m_Registrations.end() ? it->second.back() : nullptr;
         }
 
-        /**
-         * Add binding from Base to Derived type with function as instance retrieval.
-         * With this binding given function will be invoked on each retrieval request
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @param fn function to invoke when creating given Base type object
-         */
-        template<class Base, class Derived>
-        void add(const std::function<std::shared_ptr<Derived>()>& fn) // NOLINT short name
+        [[nodiscard]] ProviderRange find_providers(std::size_t id) const noexcept override
         {
-            auto factory = std::make_unique<FunctionFactory<Derived>>(fn);
-            auto storage = std::make_unique<InstanceStorage<Derived>>(std::move(factory));
-
-            add_registration<Base, Derived>(std::move(storage));
-        }
+            auto it = m_Registrations.find(id); // NOLINT short name
 
-        /**
-         * Try add binding from Base to Derived type with function as instance retrieval.
-         * This method only adds binding if Base type has not already been added.
-         * With this binding given function will be invoked on each retrieval request.
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @param fn function to invoke when creating given Base type object
-         */
-        template<class Base, class Derived>
-        void try_add(const std::function<std::shared_ptr<Derived>()>& fn) // NOLINT short name
-        {
-            if (!contains<Base>())
+            if (it != m_Registrations.end())
             {
-                add<Base, Derived>(fn);
+                auto& providers = it->second;
+                return {providers.data(), providers.data() + providers.size()};
             }
-        }
-
-        /**
-         * Add binding to given type in singleton scope with function for instance retrieval.
-         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
-         * @tparam T target for binding
-         * @param fn function to invoke when creating given type object
-         */
-        template<class T>
-        void add_singleton(const std::function<std::shared_ptr<T>()>& fn) // NOLINT short name
-        {
-            auto factory = std::make_unique<FunctionFactory<T>>(fn);
-            auto storage = std::make_unique<SingletonInstanceStorage<T>>(std::move(factory));
 
-            add_registration<T>(std::move(storage));
+            return {};
         }
 
-        /**
-         * Try add binding to given type in singleton scope with function for instance retrieval.
-         * This method only adds binding if type has not already been added.
-         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
-         * @tparam T target for binding
-         * @param fn function to invoke when creating given type object
-         */
-        template<class T>
-        void try_add_singleton(const std::function<std::shared_ptr<T>()>& fn) // NOLINT short name
+        [[nodiscard]] std::vector<IComponentProvider*> registered_providers() const override
         {
-            if (!contains<T>())
+            std::vector<IComponentProvider*> providers;
+            providers.reserve(m_Providers.size());
+
+            for (const auto& provider : m_Providers)
             {
-                add_singleton<T>(fn);
+                providers.push_back(provider.get());
             }
-        }
 
-        /**
-         * Add binding from Base to Derived type in singleton scope with function as instance retrieval.
-         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @param fn function to invoke when creating given Base type object
-         */
-        template<class Base, class Derived>
-        void add_singleton(const std::function<std::shared_ptr<Derived>()>& fn) // NOLINT short name
-        {
-            auto factory = std::make_unique<FunctionFactory<Derived>>(fn);
-            auto storage = std::make_unique<SingletonInstanceStorage<Derived>>(std::move(factory));
-
-            add_registration<Base, Derived>(std::move(storage));
+            return providers;
         }
 
-        /**
-         * Try add binding from Base to Derived type in singleton scope with function as instance retrieval.
-         * This method only adds binding if Base type has not already been added.
-         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @param fn function to invoke when creating given Base type object
-         */
-        template<class Base, class Derived>
-        void try_add_singleton(const std::function<std::shared_ptr<Derived>()>& fn) // NOLINT short name
-        {
-            if (!contains<Base>())
-            {
-                add_singleton<Base, Derived>(fn);
-            }
-        }
+        using registration_map = std::unordered_map<std::size_t, detail::ProviderList>;
 
         /**
-         * Add binding from Base to Derived type with given object.
-         * With this binding value same object will be returned on each retrieval request.
-         * This effectively makes given binding a binding in singleton scope
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @param data value to return when requesting Base type object
+         * Take ownership of provider and register it for given type.
+         * Every add method ends up here, derived injectors can override it to publish registrations differently.
+         * @param id type identifier of type the provider is registered for
+         * @param provider provider to register
          */
-        template<class Base, class Derived>
-        void add(const std::shared_ptr<Derived>& data)
+        virtual void add_provider(std::size_t id, std::unique_ptr<IComponentProvider>&& provider)
         {
-            auto factory = std::make_unique<ConstantFactory<Derived>>(data);
-            auto storage = std::make_unique<InstanceStorage<Derived>>(std::move(factory));
-
-            add_registration<Base, Derived>(std::move(storage));
+            provider->set_owner(this);
+            m_Registrations[id].push_back(provider.get());
+            m_Providers.push_back(std::move(provider));
         }
 
         /**
-         * Try add binding from Base to Derived type with given object.
-         * This method only adds binding if type has not already been added.
-         * With this binding value same object will be returned on each retrieval request.
-         * This effectively makes given binding a binding in singleton scope
-         * @tparam Base base on which binding will be performed
-         * @tparam Derived actual type that will be constructed when requesting Base type
-         * @param data value to return when requesting Base type object
+         * Take ownership of providers recorded by installed modules and register them in order.
+         * Derived injectors can drop bindings by resetting their providers before calling this implementation.
+         * @param registrations bindings of installed modules
          */
-        template<class Base, class Derived>
-        void try_add(const std::shared_ptr<Derived>& data)
-        {
-            if (!contains<Base>())
-            {
-                add<Base, Derived>(data);
-            }
-        }
-
-        // get<T>
-        template<class T,
-                 typename std::enable_if_t<!is_vector_v<T> && !is_shared_v<T>, bool> = true>
-        std::shared_ptr<T> get()
-        {
-            auto value = get_unchecked<T>();
-
-            if (!value)
-            {
-                throw ComponentCreationException();
-            }
-
-            return value;
-        }
+        virtual void add_providers(detail::PendingRegistrations&& registrations);
 
-        // get<std::shared_ptr<T>>
-        template<class T,
-                 typename std::enable_if_t<!is_vector_v<T> && is_shared_v<T>, bool> = true>
-        std::shared_ptr<typename T::element_type> get()
+        [[nodiscard]] const registration_map& registrations() const noexcept
         {
-            return get<typename T::element_type>();
-        };
-
-        // get<const T&>
-        template<class T,
-                 typename std::enable_if_t<std::is_reference_v<T> && std::is_const_v<typename std::remove_reference<T>>, bool> = true>
-        std::shared_ptr<std::remove_reference<typename std::remove_const<T>>> get()
-        {
-            return get<std::remove_reference<typename std::remove_const<T>>>();
+            return m_Registrations;
         }
 
-        // get<std::vector<T>>
-        template<class T,
-                 typename std::enable_if_t<is_vector_v<T> && !is_shared_v<typename T::value_type>, bool> = true>
-        std::vector<std::shared_ptr<typename T::value_type>> get()
+        /**
+         * Keyed identifiers are hashes, thus they may coincide with identifier of another type.
+         * Types are told apart by their type_tag, so same named types of different translation units are not mixed up either.
+         * @param type type_id of type that is being registered
+         * @param tag type_tag of type that is being registered
+         * @param existing provider already registered under the same identifier, nullptr if there is none
+         * @throws ComponentCreationException if existing provider is registered for another type
+         */
+        static void check_identifier(std::size_t type, const void* tag, const IComponentProvider* existing)
         {
-            using instance_type = typename T::value_type;
-            using provider_base = ComponentProviderBase<instance_type>;
-
-            std::vector<std::shared_ptr<instance_type>> instances;
-            auto it = m_Registrations.find(type_id<instance_type>()); // NOLINT short name
-
-            if (it != m_Registrations.end())
+            if (existing && existing->type_tag() != tag)
             {
-                auto& providers = it->second;
-                instances.reserve(providers.size());
-
-                for (auto& provider : providers)
-                {
-                    auto* component_provider = static_cast<provider_base*>(provider.get());
-                    instances.push_back(component_provider->get(*this));
-                }
+                detail::raise_unrecoverable({ErrorCode::KeyCollision, type});
             }
-
-            return instances;
-        }
-
-        // get<std::vector<std::shared_ptr<T>>>
-        template<class T,
-            typename std::enable_if_t<is_vector_v<T> && is_shared_v<typename T::value_type>, bool> = true>
-        std::vector<typename T::value_type> get()
-        {
-            return get<std::vector<typename T::value_type::element_type>>();
-        }
-
-        template<class T>
-        [[nodiscard]] bool contains() const noexcept
-        {
-            return m_Registrations.find(type_id<T>()) != m_Registrations.end();
         }
 
     private:
-        template<class T>
-        std::shared_ptr<T> get_unchecked()
+        friend class FrozenInjector;
+        friend class Registrar<Injector>;
+
+        template<class Base, class Storage, class... Args>
+        void add_registration_as(std::size_t id, bool only_if_absent, Args&&... args)
         {
-            auto it = m_Registrations.find(type_id<T>()); // NOLINT short name
+            auto* existing = find_provider(id);
+            check_identifier(type_id<Base>(), detail::type_tag<Base>(), existing);
 
-            if (it != m_Registrations.end())
+            if (only_if_absent && existing)
             {
-                auto& last_provider = it->second.back();
-                auto* provider = static_cast<ComponentProviderBase<T>*>(last_provider.get());
-
-                return provider->get(*this);
+                return;
             }
 
-            ConstructorFactory<T> factory;
-            return factory.build(*this);
-        }
-
-        template<class Base, class Derived>
-        void add_registration(std::unique_ptr<InstanceStorage<Derived>>&& storage)
-        {
-            static_assert(std::is_base_of_v<Base, Derived>, "Cannot bind unrelated types");
-
-            auto provider = std::make_unique<CastingComponentProvider<Base, Derived>>(std::move(storage));
-            m_Registrations[type_id<Base>()].push_back(std::move(provider));
+            auto provider = std::make_unique<ComponentProvider<Base, Storage>>(std::forward<Args>(args)...);
+            add_provider(id, std::move(provider));
+            increment_generation();
         }
 
-        template<class T>
-        void add_registration(std::unique_ptr<InstanceStorage<T>>&& storage)
-        {
-            auto provider = std::make_unique<NonCastingComponentProvider<T>>(std::move(storage));
-            m_Registrations[type_id<T>()].push_back(std::move(provider));
-        }
-
-        std::unordered_map<std::size_t, std::vector<std::unique_ptr<IComponentProvider>>> m_Registrations;
+        registration_map m_Registrations;
+        std::vector<std::unique_ptr<IComponentProvider>> m_Providers;
+        detail::PlanCache m_Plans;
     };
-} // namespace injector
\ No newline at end of file
+} // namespace injector
+
+#include "frozen_injector.hpp"
+#include "concurrent_injector.hpp"
+#include "child_injector.hpp"
\ No newline at end of file
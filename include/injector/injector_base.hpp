@@ -0,0 +1,697 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+
+#include "errors.hpp"
+#include "key.hpp"
+#include "metrics.hpp"
+#include "result.hpp"
+#include "traits.hpp"
+#include "type_id.hpp"
+#include "injector/detail/provider.hpp"
+
+namespace injector
+{
+    class Scope;
+
+    class ChildInjector;
+
+    namespace detail
+    {
+        template<class T>
+        class ConstructorArgumentResolver;
+
+        template<class T, class Factory>
+        class ScopedInstanceStorage;
+
+        template<class T, class Factory>
+        class ThreadLocalInstanceStorage;
+
+        template<class T, class Factory>
+        class PooledInstanceStorage;
+
+        template<class T, class Factory>
+        class CachedInstanceStorage;
+
+        template<class T>
+        struct is_injectable;
+
+        template<class T>
+        struct ConstructorKey;
+
+        template<class Key>
+        const DependencyTable* dependencies_of() noexcept;
+
+        class PlanCache;
+
+        template<class Factory, std::size_t N>
+        class PlannedArguments;
+    } // namespace detail
+
+    using detail::ConstantFactory;
+    using detail::FunctionFactory;
+    using detail::ConstructorFactory;
+
+    using detail::InstanceStorage;
+    using detail::SingletonInstanceStorage;
+    using detail::ScopedInstanceStorage;
+    using detail::ThreadLocalInstanceStorage;
+    using detail::PooledInstanceStorage;
+    using detail::CachedInstanceStorage;
+
+    using detail::IComponentProvider;
+    using detail::ComponentProviderBase;
+    using detail::ComponentProvider;
+
+    using detail::ProviderRange;
+
+    // Schedules given task for execution, e.g. on a thread pool
+    using Executor = std::function<void(std::function<void()>)>;
+
+    /**
+     * Common retrieval interface shared by every injector flavour.
+     * Derived classes only decide how registrations are looked up, resolution logic lives here.
+     */
+    class InjectorBase
+    {
+    public:
+        virtual ~InjectorBase() = default;
+
+        // get<T>
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && !is_shared_v<T> && !is_unique_v<T>, bool> = true>
+        std::shared_ptr<T> get()
+        {
+            ResolutionError error{};
+            auto value = resolve<T>(error);
+
+            if (!value)
+            {
+                detail::raise(error);
+            }
+
+            return value;
+        }
+
+        // get<std::shared_ptr<T>>
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && is_shared_v<T>, bool> = true>
+        std::shared_ptr<typename T::element_type> get()
+        {
+            return get<typename T::element_type>();
+        };
+
+        /**
+         * Retrieve object of transient constructor binding, or of type without binding, as sole owner.
+         * Object is constructed directly, without shared ownership control block.
+         * @return get<std::unique_ptr<T>>
+         * @throws ComponentCreationException if binding does not construct new objects itself or object could not be created
+         */
+        template<class T,
+                 typename std::enable_if_t<is_unique_v<T>, bool> = true>
+        T get()
+        {
+            using instance_type = typename T::element_type;
+
+            T value;
+
+            if (auto* provider = find_provider(type_id<instance_type>()))
+            {
+                auto* component_provider = detail::provider_cast<instance_type>(provider);
+
+                if (!component_provider)
+                {
+                    return nullptr;
+                }
+
+                value = component_provider->create_unique(*this);
+
+                if (!value && provider->constructed_type() == 0)
+                {
+                    detail::raise({ErrorCode::NotTransient, type_id<instance_type>()});
+                    return nullptr;
+                }
+            }
+            else if constexpr (detail::is_injectable<instance_type>::value)
+            {
+                ConstructorFactory<instance_type> factory;
+                value = factory.build_unique(*this);
+            }
+            else
+            {
+                detail::raise({ErrorCode::Unbound, type_id<instance_type>()});
+                return nullptr;
+            }
+
+            if (!value)
+            {
+                detail::raise({ErrorCode::CreationFailed, type_id<instance_type>()});
+            }
+
+            return value;
+        }
+
+        /**
+         * Construct object of given type by value, with its constructor arguments resolved by this injector.
+         * Type must either have no binding or be bound as transient constructor binding of the type itself.
+         * @tparam T type to construct
+         * @return constructed object
+         * @throws ComponentCreationException if type is bound with different lifetime or its dependencies could not be created
+         */
+        template<class T>
+        T get_value()
+        {
+            static_assert(!std::is_abstract_v<T>, "Abstract types cannot be retrieved by value");
+
+            if (auto* provider = find_provider(type_id<T>()); provider && provider->constructed_type() != type_id<T>())
+            {
+                detail::raise_unrecoverable({ErrorCode::NotTransient, type_id<T>()});
+            }
+
+            ConstructorFactory<T> factory;
+            return factory.build_value(*this);
+        }
+
+        // get<const T&>
+        template<class T,
+                 typename std::enable_if_t<std::is_reference_v<T> && std::is_const_v<typename std::remove_reference<T>>, bool> = true>
+        std::shared_ptr<std::remove_reference<typename std::remove_const<T>>> get()
+        {
+            return get<std::remove_reference<typename std::remove_const<T>>>();
+        }
+
+        /**
+         * Resolve object of given type on given executor.
+         * Singleton dependencies that do not depend on each other are created concurrently as separate tasks,
+         * the object itself is created once they are finished. Task waiting for its dependencies runs those
+         * that have not been started yet by itself, thus it never waits for tasks queued behind it
+         * and executor with a single thread is sufficient.
+         * @tparam T type to retrieve
+         * @param executor executor used for scheduling resolution tasks
+         * @return future of retrieved object, holding exception if it could not be created
+         */
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && !is_shared_v<T> && !is_unique_v<T>, bool> = true>
+        std::future<std::shared_ptr<T>> get_async(const Executor& executor)
+        {
+            auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+            auto future = promise->get_future();
+
+            executor([this, executor, promise] {
+#if INJECTOR_HAS_EXCEPTIONS
+                try
+                {
+                    prefetch<T>(executor);
+                    promise->set_value(get<T>());
+                }
+                catch (...)
+                {
+                    promise->set_exception(std::current_exception());
+                }
+#else
+                prefetch<T>(executor);
+                promise->set_value(get<T>());
+#endif
+            });
+
+            return future;
+        }
+
+        // get_async<std::shared_ptr<T>>
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && is_shared_v<T>, bool> = true>
+        std::future<std::shared_ptr<typename T::element_type>> get_async(const Executor& executor)
+        {
+            return get_async<typename T::element_type>(executor);
+        }
+
+        /**
+         * Retrieve object of given type without throwing when it cannot be resolved.
+         * Missing binding of type that cannot be constructed is reported without throwing any exception internally,
+         * failures of its dependencies are caught and reported as well. Exceptions thrown by factories are not caught.
+         * Usable when exceptions are disabled, then dependency graph of each constructor is checked before its
+         * arguments are created, so constructors never receive missing dependencies. Only objects of factory functions
+         * that return nullptr reach their dependants as nullptr, those dependants are discarded afterwards.
+         * @tparam T type to retrieve
+         * @return retrieved object or error describing innermost type that failed to resolve
+         */
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && !is_shared_v<T> && !is_unique_v<T>, bool> = true>
+        Result<T> try_get()
+        {
+            ResolutionError error{};
+
+#if INJECTOR_HAS_EXCEPTIONS
+            try
+            {
+                if (auto value = resolve<T>(error))
+                {
+                    return value;
+                }
+            }
+            catch (const ComponentCreationException& exception)
+            {
+                return exception.error();
+            }
+#else
+            detail::ErrorSink sink;
+            detail::ErrorSinkGuard guard(sink);
+
+            auto value = resolve<T>(error);
+
+            if (sink.failures != 0)
+            {
+                return sink.error;
+            }
+
+            if (value)
+            {
+                return value;
+            }
+#endif
+
+            return error;
+        }
+
+        // try_get<std::shared_ptr<T>>
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && is_shared_v<T>, bool> = true>
+        Result<typename T::element_type> try_get()
+        {
+            return try_get<typename T::element_type>();
+        }
+
+        // get<std::vector<T>>
+        template<class T,
+                 typename std::enable_if_t<is_vector_v<T> && !is_shared_v<typename T::value_type>, bool> = true>
+        std::vector<std::shared_ptr<typename T::value_type>> get()
+        {
+            using instance_type = typename T::value_type;
+            std::vector<std::shared_ptr<instance_type>> instances;
+            auto providers = find_providers(type_id<instance_type>());
+            instances.reserve(providers.size());
+
+            for (auto* provider : providers)
+            {
+                auto* component_provider = detail::provider_cast<instance_type>(provider);
+
+                if (!component_provider)
+                {
+                    return {};
+                }
+
+                instances.push_back(component_provider->get_fast(*this));
+            }
+
+            return instances;
+        }
+
+        // get<std::vector<std::shared_ptr<T>>>
+        template<class T,
+            typename std::enable_if_t<is_vector_v<T> && is_shared_v<typename T::value_type>, bool> = true>
+        std::vector<typename T::value_type> get()
+        {
+            return get<std::vector<typename T::value_type::element_type>>();
+        }
+
+        /**
+         * Retrieve reference to object kept by singleton, constant or scoped binding without touching its reference count.
+         * Reference stays valid for as long as this injector exists.
+         * @tparam T type to retrieve
+         * @return reference to retrieved object
+         * @throws ComponentCreationException if type is not bound with lifetime that keeps its object or object could not be created
+         */
+        template<class T>
+        T& get_ref()
+        {
+            auto* provider = find_provider(type_id<T>());
+
+            if (!provider)
+            {
+                detail::raise_unrecoverable({ErrorCode::Unbound, type_id<T>()});
+            }
+
+            if (provider->type_tag() != detail::type_tag<T>())
+            {
+                detail::raise_unrecoverable({ErrorCode::KeyCollision, type_id<T>()});
+            }
+
+            if (auto* instance = static_cast<ComponentProviderBase<T>*>(provider)->borrow_fast(*this))
+            {
+                return *instance;
+            }
+
+            detail::raise_unrecoverable({ErrorCode::NotBorrowable, type_id<T>()});
+        }
+
+        /**
+         * Invoke given function with each object registered for given type, in registration order.
+         * Objects kept by their bindings are passed without touching reference count, no memory is allocated
+         * unless binding itself constructs new object.
+         * @tparam T type to retrieve
+         * @param fn function invoked as fn(T&), object is only guaranteed to be alive during the call
+         * @throws ComponentCreationException if any of the objects could not be created
+         */
+        template<class T, class Fn>
+        void for_each(Fn&& fn) // NOLINT missing std::forward, function is invoked multiple times
+        {
+            for (auto* provider : find_providers(type_id<T>()))
+            {
+                auto* component_provider = detail::provider_cast<T>(provider);
+
+                if (!component_provider)
+                {
+                    return;
+                }
+
+                if (auto* instance = component_provider->borrow_fast(*this))
+                {
+                    fn(*instance);
+                }
+                else
+                {
+                    auto value = component_provider->get_fast(*this);
+
+                    if (!value)
+                    {
+                        detail::raise({ErrorCode::CreationFailed, type_id<T>()});
+                        return;
+                    }
+
+                    fn(*value);
+                }
+            }
+        }
+
+        /**
+         * Retrieve references to all objects registered for given type, in registration order.
+         * Intended for multi-bindings that consist only of singletons or constants, returned list can be kept
+         * and iterated directly since references stay valid for as long as this injector exists.
+         * Registrations added afterwards are not reflected in the returned list.
+         * @tparam T type to retrieve
+         * @return references to retrieved objects
+         * @throws ComponentCreationException if any of the bindings does not keep its object or object could not be created
+         */
+        template<class T>
+        std::vector<std::reference_wrapper<T>> get_refs()
+        {
+            std::vector<std::reference_wrapper<T>> instances;
+            auto providers = find_providers(type_id<T>());
+            instances.reserve(providers.size());
+
+            for (auto* provider : providers)
+            {
+                auto* component_provider = detail::provider_cast<T>(provider);
+
+                if (!component_provider)
+                {
+                    return {};
+                }
+
+                auto* instance = component_provider->borrow_fast(*this);
+
+                if (!instance)
+                {
+                    detail::raise({ErrorCode::NotBorrowable, type_id<T>()});
+                    return {};
+                }
+
+                instances.emplace_back(*instance);
+            }
+
+            return instances;
+        }
+
+        /**
+         * Retrieve object of given type registered under given key.
+         * Lookup costs one probe of registrations, same as for binding without key.
+         * Types without keyed binding are not constructed implicitly.
+         * @tparam T type to retrieve
+         * @param key key the binding was registered under
+         * @return retrieved object
+         * @throws ComponentCreationException if there is no binding under given key or object could not be created
+         */
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && !is_shared_v<T> && !is_unique_v<T>, bool> = true>
+        std::shared_ptr<T> get(const Key& key)
+        {
+            auto* provider = find_provider(keyed_type_id<T>(key));
+
+            if (!provider)
+            {
+                detail::raise({ErrorCode::Unbound, type_id<T>()});
+                return nullptr;
+            }
+
+            auto* component_provider = detail::provider_cast<T>(provider);
+
+            if (!component_provider)
+            {
+                return nullptr;
+            }
+
+            auto value = component_provider->get_fast(*this);
+
+            if (!value)
+            {
+                detail::raise({ErrorCode::CreationFailed, type_id<T>()});
+            }
+
+            return value;
+        }
+
+        // get<std::shared_ptr<T>>(key)
+        template<class T,
+                 typename std::enable_if_t<!is_vector_v<T> && is_shared_v<T>, bool> = true>
+        std::shared_ptr<typename T::element_type> get(const Key& key)
+        {
+            return get<typename T::element_type>(key);
+        }
+
+        template<class T>
+        [[nodiscard]] bool contains() const noexcept
+        {
+            return find_provider(type_id<T>()) != nullptr;
+        }
+
+        template<class T>
+        [[nodiscard]] bool contains(const Key& key) const noexcept
+        {
+            return find_provider(keyed_type_id<T>(key)) != nullptr;
+        }
+
+        /**
+         * Identifier of current registration state of this injector, changes with each registration.
+         * Values are unique across all injectors and cached resolution plans are only valid for generation they were compiled in.
+         * @return current registration generation
+         */
+        [[nodiscard]] virtual std::size_t generation() const noexcept
+        {
+            return m_Generation.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Eagerly create all singleton bindings by scheduling each of them as separate task on given executor.
+         * Singletons that do not depend on each other are built in parallel, singleton that is needed by
+         * several tasks is built by one of them while the rest wait for it, thus construction follows dependency graph.
+         * Blocks until all scheduled tasks have finished.
+         * @param executor executor used for scheduling construction tasks
+         * @throws ComponentCreationException if any singleton could not be created, exceptions thrown by factories are rethrown
+         */
+        void warm_up(const Executor& executor);
+
+        /**
+         * Eagerly create all singleton bindings on calling thread.
+         * @see warm_up(const Executor&)
+         */
+        void warm_up();
+
+        /**
+         * Collect resolution statistics of all bindings registered in this injector.
+         * Statistics are only gathered when library is built with INJECTOR_ENABLE_METRICS, otherwise result is empty.
+         * @return snapshot of statistics, one entry per binding
+         */
+        [[nodiscard]] std::vector<BindingMetrics> metrics() const;
+
+        /**
+         * Check dependency graph of all bindings registered in this injector without creating any object.
+         * Reports dependencies without binding that cannot be constructed, bindings whose constructors cannot be satisfied,
+         * exclusively owned dependencies whose bindings do not construct new objects and dependency cycles.
+         * Lazy and Provider dependencies are only checked for being resolvable, they do not form cycles.
+         * Arguments of bindings created by functions are checked as well, objects returned by the functions are not.
+         * @return found problems, each with full path from validated binding, empty if graph is valid
+         */
+        [[nodiscard]] std::vector<ValidationError> validate() const;
+
+        /**
+         * Create unit of work scope on top of this injector.
+         * Scoped bindings are created once per scope and released together with it.
+         * Scope does not copy any registrations, this injector must outlive it.
+         * @return new empty scope
+         */
+        [[nodiscard]] Scope create_scope();
+
+        /**
+         * Create injector that overlays this one.
+         * Child keeps only its own registrations, types it does not register are looked up in this injector,
+         * thus bindings, including singletons, are shared with it. Creating a child allocates nothing.
+         * This injector must outlive the child.
+         * @return new child injector without registrations
+         */
+        [[nodiscard]] ChildInjector create_child();
+
+        /**
+         * Resolution plans are kept by injector that defines lookups, so injectors sharing bindings,
+         * e.g. children of the same parent, never invalidate plans of each other.
+         * @return cache of resolution plans compiled against this injector, nullptr if plans are not cached
+         */
+        [[nodiscard]] virtual detail::PlanCache* plans() noexcept
+        {
+            return nullptr;
+        }
+
+        /**
+         * @return innermost scope this injector resolves in, nullptr when resolving outside of any scope
+         */
+        [[nodiscard]] virtual Scope* scope() noexcept
+        {
+            return nullptr;
+        }
+
+    protected:
+        InjectorBase() noexcept
+            : m_Generation(next_generation())
+        {
+        }
+
+        InjectorBase(const InjectorBase&) = delete;
+
+        // moved from injector loses its registrations, thus it gets new generation
+        InjectorBase(InjectorBase&& other) noexcept
+            : m_Generation(other.m_Generation.exchange(next_generation(), std::memory_order_acq_rel))
+        {
+        }
+
+        InjectorBase& operator=(const InjectorBase&) = delete;
+
+        InjectorBase& operator=(InjectorBase&& other) noexcept
+        {
+            m_Generation.store(other.m_Generation.exchange(next_generation(), std::memory_order_acq_rel), std::memory_order_release);
+            return *this;
+        }
+
+        /**
+         * Find provider that should serve single instance requests of given type.
+         * @param id type identifier obtained from type_id
+         * @return last registered provider for given type or nullptr if there is no registration
+         */
+        [[nodiscard]] virtual IComponentProvider* find_provider(std::size_t id) const noexcept = 0;
+
+        /**
+         * Find all providers registered for given type in registration order.
+         * @param id type identifier obtained from type_id
+         * @return range of providers, empty if there is no registration
+         */
+        [[nodiscard]] virtual ProviderRange find_providers(std::size_t id) const noexcept = 0;
+
+        /**
+         * @return all providers owned by this injector, each of them exactly once
+         */
+        [[nodiscard]] virtual std::vector<IComponentProvider*> registered_providers() const = 0;
+
+        // Must be called after registrations have been changed and made visible to readers
+        void increment_generation() noexcept
+        {
+            m_Generation.store(next_generation(), std::memory_order_release);
+        }
+
+        /**
+         * @return generation value that has not been handed out before, values grow monotonically
+         */
+        static std::size_t next_generation() noexcept;
+
+    private:
+        friend class Scope;
+        friend class ChildInjector;
+
+        template<class T>
+        friend class detail::ConstructorArgumentResolver;
+
+        template<class Factory, std::size_t N>
+        friend class detail::PlannedArguments;
+
+        class Validator;
+
+        /**
+         * Resolve object through its binding, types without binding are constructed directly when possible.
+         * @param error set to the failure reason when nullptr is returned
+         */
+        template<class T>
+        std::shared_ptr<T> resolve(ResolutionError& error)
+        {
+            std::shared_ptr<T> value;
+
+            if (auto* provider = find_provider(type_id<T>()))
+            {
+                if (provider->type_tag() != detail::type_tag<T>())
+                {
+                    error = {ErrorCode::KeyCollision, type_id<T>()};
+                    return nullptr;
+                }
+
+                value = static_cast<ComponentProviderBase<T>*>(provider)->get_fast(*this);
+            }
+            else if constexpr (detail::is_injectable<T>::value)
+            {
+                ConstructorFactory<T> factory;
+                value = factory.build(*this);
+            }
+            else
+            {
+                error = {ErrorCode::Unbound, type_id<T>()};
+                return nullptr;
+            }
+
+            if (!value)
+            {
+                error = {ErrorCode::CreationFailed, type_id<T>()};
+            }
+
+            return value;
+        }
+
+        // Create singleton dependencies of given type concurrently on given executor
+        template<class T>
+        void prefetch(const Executor& executor)
+        {
+            if (auto* provider = find_provider(type_id<T>()))
+            {
+                prefetch(*provider->dependency_node().dependencies, executor);
+            }
+            else if constexpr (detail::is_injectable<T>::value)
+            {
+                prefetch(*detail::dependencies_of<detail::ConstructorKey<T>>(), executor);
+            }
+        }
+
+        void prefetch(const detail::DependencyTable& dependencies, const Executor& executor);
+
+        /**
+         * Check that dependencies of factory can be created without creating any of them.
+         * Deferred dependencies are not checked since they are only resolved when used.
+         * @param dependencies arguments of the factory
+         * @return true if every dependency can be resolved, otherwise innermost failure is reported through raise
+         */
+        bool check_dependencies(const detail::DependencyTable* dependencies) const;
+
+        std::atomic<std::size_t> m_Generation;
+    };
+} // namespace injector
+
+#include "injector/detail/argument_resolver.hpp"
+#include "injector/detail/thread_local_storage.hpp"
+#include "injector/detail/pooled_storage.hpp"
+#include "injector/detail/cached_storage.hpp"
+#include "scope.hpp"
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "type_id.hpp"
+
+namespace injector
+{
+    /**
+     * Name distinguishing several bindings of the same type, e.g. "primary"_key and "replica"_key.
+     * Name is hashed when key is created, which only happens at compile time if key is constant evaluated.
+     * Keys obtained from key<"name"_hash> carry their hash as template argument, thus they are never hashed at run time.
+     */
+    class Key
+    {
+    public:
+        constexpr explicit Key(std::string_view name) noexcept
+            : m_Name(name),
+              m_Hash(detail::hash_string(name.data(), name.size()))
+        {
+        }
+
+        /**
+         * @param hash hash of key name, e.g. computed by "name"_hash
+         * @return key with given hash and without name
+         */
+        static constexpr Key from_hash(std::uint64_t hash) noexcept
+        {
+            return Key(std::string_view(), hash);
+        }
+
+        [[nodiscard]] constexpr std::string_view name() const noexcept
+        {
+            return m_Name;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t hash() const noexcept
+        {
+            return m_Hash;
+        }
+
+    private:
+        constexpr Key(std::string_view name, std::uint64_t hash) noexcept
+            : m_Name(name),
+              m_Hash(hash)
+        {
+        }
+
+        std::string_view m_Name;
+        std::uint64_t m_Hash;
+    };
+
+    /**
+     * Key hashed at compile time wherever it is used, e.g. key<"replica"_hash>.
+     * @tparam Hash hash of key name obtained from "name"_hash
+     */
+    template<std::uint64_t Hash>
+    inline constexpr Key key = Key::from_hash(Hash);
+
+    namespace literals
+    {
+        constexpr Key operator""_key(const char* name, std::size_t length) noexcept
+        {
+            return Key(std::string_view(name, length));
+        }
+
+        // Hash of key name, same as hash of Key created from the name
+        constexpr std::uint64_t operator""_hash(const char* name, std::size_t length) noexcept
+        {
+            return detail::hash_string(name, length);
+        }
+    } // namespace literals
+
+    /**
+     * Registration key of given type bound under given key, it is looked up the same way as type_id.
+     * Identifier may collide with identifier of another type, such collisions are reported when the binding is registered.
+     * @tparam T type the binding is registered for
+     * @param key key of the binding
+     * @return identifier combining type and key
+     */
+    template<class T>
+    constexpr std::size_t keyed_type_id(const Key& key) noexcept
+    {
+        constexpr auto id = static_cast<std::uint64_t>(type_id<T>());
+
+        // mixing keeps keyed identifiers apart from plain type identifiers and from the same key of other types
+        return static_cast<std::size_t>(id ^ (key.hash() + 0x9e3779b97f4a7c15ULL + (id << 6) + (id >> 2))); // NOLINT magic number
+    }
+} // namespace injector
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "injector_base.hpp"
+
+namespace injector
+{
+    /**
+     * Handle that resolves given type on first access and keeps the result afterwards.
+     * Can be used as constructor parameter to defer construction of rarely used dependencies.
+     * Safe to access from multiple threads. Handle resolves through injector its owner was created in, which is
+     * the injector owning the binding for singletons and other instances outliving single resolution,
+     * that injector must outlive the handle.
+     * @tparam T type to resolve
+     */
+    template<class T>
+    class Lazy
+    {
+    public:
+        explicit Lazy(InjectorBase& injector) noexcept
+            : m_Injector(std::addressof(injector))
+        {
+        }
+
+        // Handle is only moved while object owning it is being constructed, never concurrently with access
+        Lazy(Lazy&& other) noexcept
+            : m_Injector(other.m_Injector),
+              m_Instance(std::move(other.m_Instance)),
+              m_Resolved(other.m_Resolved.load(std::memory_order_relaxed))
+        {
+        }
+
+        Lazy(const Lazy&) = delete;
+        Lazy& operator=(const Lazy&) = delete;
+        Lazy& operator=(Lazy&&) = delete;
+
+        ~Lazy() = default;
+
+        /**
+         * Resolve object on first call, following calls return the same object.
+         * @return resolved object
+         * @throws ComponentCreationException if object could not be created, next call will try again
+         */
+        const std::shared_ptr<T>& get() const
+        {
+            if (!m_Resolved.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+
+                if (!m_Resolved.load(std::memory_order_relaxed))
+                {
+                    m_Instance = m_Injector->get<T>();
+                    m_Resolved.store(m_Instance != nullptr, std::memory_order_release);
+                }
+            }
+
+            return m_Instance;
+        }
+
+        T& operator*() const
+        {
+            return *get();
+        }
+
+        T* operator->() const
+        {
+            return get().get();
+        }
+
+        /**
+         * @return true if object has already been resolved
+         */
+        [[nodiscard]] bool resolved() const noexcept
+        {
+            return m_Resolved.load(std::memory_order_acquire);
+        }
+
+    private:
+        InjectorBase* m_Injector;
+        mutable std::shared_ptr<T> m_Instance;
+        mutable std::atomic<bool> m_Resolved = false;
+        mutable std::mutex m_Mutex;
+    };
+
+    /**
+     * Handle that resolves given type on each call, lifetime of returned objects is decided by their binding.
+     * Can be used as constructor parameter to create dependencies on demand.
+     * Injector that created the handle must outlive it, see Lazy for which injector that is.
+     * @tparam T type to resolve
+     */
+    template<class T>
+    class Provider
+    {
+    public:
+        explicit Provider(InjectorBase& injector) noexcept
+            : m_Injector(std::addressof(injector))
+        {
+        }
+
+        /**
+         * @return resolved object
+         * @throws ComponentCreationException if object could not be created
+         */
+        std::shared_ptr<T> get() const
+        {
+            return m_Injector->get<T>();
+        }
+
+        std::shared_ptr<T> operator()() const
+        {
+            return get();
+        }
+
+    private:
+        InjectorBase* m_Injector;
+    };
+} // namespace injector
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#ifndef INJECTOR_ENABLE_METRICS
+    #define INJECTOR_ENABLE_METRICS 0
+#endif
+
+namespace injector
+{
+    // Identity of a single binding
+    struct BindingInfo
+    {
+        // type_id of type the binding is registered for
+        std::size_t type;
+        // name of type the binding is registered for
+        std::string_view type_name;
+        // name of type the binding constructs
+        std::string_view implementation_name;
+    };
+
+    // Snapshot of resolution statistics of a single binding
+    struct BindingMetrics
+    {
+        BindingInfo binding;
+        // number of retrieval requests served by the binding
+        std::uint64_t resolutions;
+        // number of objects created by the binding
+        std::uint64_t constructions;
+        std::chrono::nanoseconds total_construction_time;
+        std::chrono::nanoseconds max_construction_time;
+        // size of objects created by the binding, memory allocated by the objects themselves is not included
+        std::uint64_t allocated_bytes;
+    };
+
+    /**
+     * Receives resolution events of all injectors, e.g. for exporting them to monitoring system.
+     * Callbacks are invoked on resolving thread while resolution is in progress, thus they must be thread safe and cheap.
+     * Only invoked when library is built with INJECTOR_ENABLE_METRICS.
+     */
+    class ResolutionObserver
+    {
+    public:
+        virtual ~ResolutionObserver() = default;
+
+        /**
+         * @param binding binding that served retrieval request
+         */
+        virtual void on_resolve(const BindingInfo& binding) = 0;
+
+        /**
+         * @param binding binding that created new object
+         * @param duration time spent creating the object, including its dependencies
+         */
+        virtual void on_construct(const BindingInfo& binding, std::chrono::nanoseconds duration) = 0;
+    };
+
+    /**
+     * Install observer receiving resolution events of all injectors.
+     * @param observer observer to install, nullptr to remove current one, it must outlive all resolutions that use it
+     */
+    void set_resolution_observer(ResolutionObserver* observer) noexcept;
+
+    namespace detail
+    {
+        ResolutionObserver* resolution_observer() noexcept;
+
+        // Statistics of single binding, updated concurrently by resolving threads
+        class BindingCounters
+        {
+        public:
+            void record_resolution(const BindingInfo& binding) noexcept
+            {
+                m_Resolutions.fetch_add(1, std::memory_order_relaxed);
+
+                if (auto* observer = resolution_observer())
+                {
+                    observer->on_resolve(binding);
+                }
+            }
+
+            void record_construction(const BindingInfo& binding, std::chrono::nanoseconds duration, std::size_t bytes) noexcept
+            {
+                const auto nanoseconds = static_cast<std::uint64_t>(duration.count());
+
+                m_Constructions.fetch_add(1, std::memory_order_relaxed);
+                m_TotalTime.fetch_add(nanoseconds, std::memory_order_relaxed);
+                m_AllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+                auto max = m_MaxTime.load(std::memory_order_relaxed);
+
+                while (max < nanoseconds && !m_MaxTime.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+                {
+                }
+
+                if (auto* observer = resolution_observer())
+                {
+                    observer->on_construct(binding, duration);
+                }
+            }
+
+            [[nodiscard]] BindingMetrics snapshot(const BindingInfo& binding) const noexcept
+            {
+                return {
+                    binding,
+                    m_Resolutions.load(std::memory_order_relaxed),
+                    m_Constructions.load(std::memory_order_relaxed),
+                    std::chrono::nanoseconds(m_TotalTime.load(std::memory_order_relaxed)),
+                    std::chrono::nanoseconds(m_MaxTime.load(std::memory_order_relaxed)),
+                    m_AllocatedBytes.load(std::memory_order_relaxed),
+                };
+            }
+
+        private:
+            std::atomic<std::uint64_t> m_Resolutions = 0;
+            std::atomic<std::uint64_t> m_Constructions = 0;
+            std::atomic<std::uint64_t> m_TotalTime = 0;
+            std::atomic<std::uint64_t> m_MaxTime = 0;
+            std::atomic<std::uint64_t> m_AllocatedBytes = 0;
+        };
+
+        struct ActiveBinding
+        {
+            BindingCounters* counters;
+            const BindingInfo* binding;
+        };
+
+        inline ActiveBinding& active_binding() noexcept
+        {
+            static thread_local ActiveBinding active{nullptr, nullptr};
+            return active;
+        }
+
+        /**
+         * Marks binding whose storage is being accessed on current thread, so constructions performed by the storage
+         * are attributed to it. Nested resolutions of dependencies restore previous binding once they finish.
+         */
+        class ActiveBindingGuard
+        {
+        public:
+            ActiveBindingGuard(BindingCounters& counters, const BindingInfo& binding) noexcept
+                : m_Previous(active_binding())
+            {
+                active_binding() = {std::addressof(counters), std::addressof(binding)};
+                counters.record_resolution(binding);
+            }
+
+            ActiveBindingGuard(const ActiveBindingGuard&) = delete;
+            ActiveBindingGuard& operator=(const ActiveBindingGuard&) = delete;
+
+            ~ActiveBindingGuard()
+            {
+                active_binding() = m_Previous;
+            }
+
+        private:
+            ActiveBinding m_Previous;
+        };
+
+        /**
+         * Create object with given function and record it as construction of currently active binding.
+         * @param create function creating the object
+         * @return created object
+         */
+        template<class Create>
+        auto record_construction(Create&& create)
+        {
+            const auto active = active_binding();
+            const auto start = std::chrono::steady_clock::now();
+
+            auto instance = create();
+
+            if (active.counters && instance)
+            {
+                const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                active.counters->record_construction(*active.binding, duration, sizeof(*instance));
+            }
+
+            return instance;
+        }
+    } // namespace detail
+} // namespace injector
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <iterator>
+#include <vector>
+
+#include "registrar.hpp"
+
+namespace injector
+{
+    class Injector;
+
+    namespace detail
+    {
+        // Bindings recorded by modules in registration order, kept as parallel arrays to make recording cheap
+        struct PendingRegistrations
+        {
+            std::vector<std::size_t> ids;
+            std::vector<std::unique_ptr<IComponentProvider>> providers;
+            // set by try_add family, binding is dropped if injector already provides the type
+            std::vector<bool> only_if_absent;
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return ids.size();
+            }
+
+            void append(PendingRegistrations&& other)
+            {
+                ids.insert(ids.end(), other.ids.begin(), other.ids.end());
+                providers.insert(providers.end(), std::make_move_iterator(other.providers.begin()), std::make_move_iterator(other.providers.end()));
+                only_if_absent.insert(only_if_absent.end(), other.only_if_absent.begin(), other.only_if_absent.end());
+
+                other.clear();
+            }
+
+            void clear() noexcept
+            {
+                ids.clear();
+                providers.clear();
+                only_if_absent.clear();
+            }
+        };
+    } // namespace detail
+
+    /**
+     * Batch of bindings installed into injector at once, e.g. all bindings of one subsystem.
+     * Module provides the same add methods as Injector, but only records bindings without any lookups.
+     * Derived classes typically register their bindings in constructor.
+     * Checks of try_add family are performed while installing, taking earlier bindings of the same batch into account.
+     * @see Injector::install
+     */
+    class Module : public Registrar<Module>
+    {
+    public:
+        Module() = default;
+
+        Module(const Module&) = delete;
+        Module(Module&&) noexcept = default;
+        Module& operator=(const Module&) = delete;
+        Module& operator=(Module&&) noexcept = default;
+
+        ~Module() = default;
+
+        /**
+         * @return number of recorded bindings
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_Registrations.size();
+        }
+
+    private:
+        friend class Registrar<Module>;
+        friend class Injector;
+
+        template<class Base, class Storage, class... Args>
+        void add_registration_as(std::size_t id, bool only_if_absent, Args&&... args)
+        {
+            m_Registrations.providers.push_back(std::make_unique<ComponentProvider<Base, Storage>>(std::forward<Args>(args)...));
+            m_Registrations.ids.push_back(id);
+            m_Registrations.only_if_absent.push_back(only_if_absent);
+        }
+
+        detail::PendingRegistrations m_Registrations;
+    };
+} // namespace injector
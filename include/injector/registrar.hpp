@@ -0,0 +1,797 @@
+#pragma once
+
+#include "allocator.hpp"
+#include "injector_base.hpp"
+
+namespace injector
+{
+    /**
+     * Registration interface shared by Injector and Module.
+     * Each method describes binding as provider registered under identifier, Self decides when it is inserted.
+     * @tparam Self class deriving from this one, implementing add_registration_as(id, only_if_absent, args...)
+     */
+    template<class Self>
+    class Registrar
+    {
+    public:
+        /**
+         * Add binding to given type.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam T target for binding
+         */
+        template<class T>
+        void add()
+        {
+            add_registration<T, InstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Try add binding to given type.
+         * This method only adds given type if it has not already been added.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam T target for binding
+         * @see add
+         */
+        template<class T>
+        void try_add()
+        {
+            try_add_registration<T, InstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Add binding from Base to Derived type.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         */
+        template<class Base, class Derived>
+        void add()
+        {
+            add_registration<Base, InstanceStorage<Derived, ConstructorFactory<Derived>>>();
+        }
+
+        /**
+         * Try to add binding from Base to Derived type.
+         * This method only adds given binding if Base has not already been added.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam Base base type on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @see add
+         */
+        template<class Base, class Derived>
+        void try_add()
+        {
+            try_add_registration<Base, InstanceStorage<Derived, ConstructorFactory<Derived>>>();
+        }
+
+        /**
+         * Add binding to given type in singleton scope (each request to given type will produce same object).
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         */
+        template<class T>
+        void add_singleton()
+        {
+            add_registration<T, SingletonInstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Try to add binding to given type in singleton scope (each request to given type will produce same object).
+         * This method only adds given type if it has not already been added.
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         * @seem add_singleton
+         */
+        template<class T>
+        void try_add_singleton()
+        {
+            try_add_registration<T, SingletonInstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Add binding from Base to Derived type in singleton scope (each request to Base type will produce same Derived instance object).
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived Derived actual type that will be constructed when requesting Base type
+         */
+        template<class Base, class Derived>
+        void add_singleton()
+        {
+            add_registration<Base, SingletonInstanceStorage<Derived, ConstructorFactory<Derived>, Base>>();
+        }
+
+        /**
+         * Try to add binding from Base to Derived type in singleton scope (each request to Base type will produce same Derived instance object).
+         * This method only adds given binding if Base type has not already been added.
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived Derived actual type that will be constructed when requesting Base type
+         */
+        template<class Base, class Derived>
+        void try_add_singleton()
+        {
+            try_add_registration<Base, SingletonInstanceStorage<Derived, ConstructorFactory<Derived>, Base>>();
+        }
+
+        /**
+         * Add binding to given type with function for instance retrieval.
+         * With this binding given function will be invoked on each retrieval request
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void add(Fn&& fn) // NOLINT short name
+        {
+            add_registration<T, InstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding to given type with function for instance retrieval.
+         * This method only adds binding if type has not already been added.
+         * With this binding given function will be invoked on each retrieval request
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void try_add(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<T, InstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding from Base to Derived type with function as instance retrieval.
+         * With this binding given function will be invoked on each retrieval request
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void add(Fn&& fn) // NOLINT short name
+        {
+            add_registration<Base, InstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding from Base to Derived type with function as instance retrieval.
+         * This method only adds binding if Base type has not already been added.
+         * With this binding given function will be invoked on each retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void try_add(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<Base, InstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding to given type in singleton scope with function for instance retrieval.
+         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void add_singleton(Fn&& fn) // NOLINT short name
+        {
+            add_registration<T, SingletonInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding to given type in singleton scope with function for instance retrieval.
+         * This method only adds binding if type has not already been added.
+         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void try_add_singleton(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<T, SingletonInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding from Base to Derived type in singleton scope with function as instance retrieval.
+         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void add_singleton(Fn&& fn) // NOLINT short name
+        {
+            add_registration<Base, SingletonInstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>, Base>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding from Base to Derived type in singleton scope with function as instance retrieval.
+         * This method only adds binding if Base type has not already been added.
+         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void try_add_singleton(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<Base, SingletonInstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>, Base>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding to given type in scoped lifetime (each request within the same scope will produce same object).
+         * With this binding given type will be created on first retrieval request in each scope and released together with the scope.
+         * Retrieving given type outside of a scope fails.
+         * @tparam T target for binding
+         * @see InjectorBase::create_scope
+         */
+        template<class T>
+        void add_scoped()
+        {
+            add_registration<T, ScopedInstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Try to add binding to given type in scoped lifetime (each request within the same scope will produce same object).
+         * This method only adds given type if it has not already been added.
+         * @tparam T target for binding
+         * @see add_scoped
+         */
+        template<class T>
+        void try_add_scoped()
+        {
+            try_add_registration<T, ScopedInstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Add binding from Base to Derived type in scoped lifetime (each request to Base type within the same scope will produce same Derived instance object).
+         * With this binding given type will be created on first retrieval request in each scope and released together with the scope.
+         * Retrieving given type outside of a scope fails.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @see InjectorBase::create_scope
+         */
+        template<class Base, class Derived>
+        void add_scoped()
+        {
+            add_registration<Base, ScopedInstanceStorage<Derived, ConstructorFactory<Derived>>>();
+        }
+
+        /**
+         * Try to add binding from Base to Derived type in scoped lifetime (each request to Base type within the same scope will produce same Derived instance object).
+         * This method only adds given binding if Base type has not already been added.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @see add_scoped
+         */
+        template<class Base, class Derived>
+        void try_add_scoped()
+        {
+            try_add_registration<Base, ScopedInstanceStorage<Derived, ConstructorFactory<Derived>>>();
+        }
+
+        /**
+         * Add binding to given type in scoped lifetime with function for instance retrieval.
+         * With this binding given function will be invoked on first retrieval request in each scope
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void add_scoped(Fn&& fn) // NOLINT short name
+        {
+            add_registration<T, ScopedInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding to given type in scoped lifetime with function for instance retrieval.
+         * This method only adds binding if type has not already been added.
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void try_add_scoped(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<T, ScopedInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding from Base to Derived type in scoped lifetime with function as instance retrieval.
+         * With this binding given function will be invoked on first retrieval request in each scope
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void add_scoped(Fn&& fn) // NOLINT short name
+        {
+            add_registration<Base, ScopedInstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding from Base to Derived type in scoped lifetime with function as instance retrieval.
+         * This method only adds binding if Base type has not already been added.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void try_add_scoped(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<Base, ScopedInstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding to given type in thread local lifetime (each request from the same thread will produce same object).
+         * With this binding given type will be created on first retrieval request in each thread and released when the thread exits.
+         * Intended for objects that are not thread safe, retrieval after the first one does not share any memory with other threads.
+         * @tparam T target for binding
+         */
+        template<class T>
+        void add_thread_local()
+        {
+            add_registration<T, ThreadLocalInstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Try to add binding to given type in thread local lifetime (each request from the same thread will produce same object).
+         * This method only adds given type if it has not already been added.
+         * @tparam T target for binding
+         * @see add_thread_local
+         */
+        template<class T>
+        void try_add_thread_local()
+        {
+            try_add_registration<T, ThreadLocalInstanceStorage<T, ConstructorFactory<T>>>();
+        }
+
+        /**
+         * Add binding from Base to Derived type in thread local lifetime (each request to Base type from the same thread will produce same Derived instance object).
+         * With this binding given type will be created on first retrieval request in each thread and released when the thread exits.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         */
+        template<class Base, class Derived>
+        void add_thread_local()
+        {
+            add_registration<Base, ThreadLocalInstanceStorage<Derived, ConstructorFactory<Derived>>>();
+        }
+
+        /**
+         * Try to add binding from Base to Derived type in thread local lifetime (each request to Base type from the same thread will produce same Derived instance object).
+         * This method only adds given binding if Base type has not already been added.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @see add_thread_local
+         */
+        template<class Base, class Derived>
+        void try_add_thread_local()
+        {
+            try_add_registration<Base, ThreadLocalInstanceStorage<Derived, ConstructorFactory<Derived>>>();
+        }
+
+        /**
+         * Add binding to given type in thread local lifetime with function for instance retrieval.
+         * With this binding given function will be invoked on first retrieval request in each thread
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void add_thread_local(Fn&& fn) // NOLINT short name
+        {
+            add_registration<T, ThreadLocalInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding to given type in thread local lifetime with function for instance retrieval.
+         * This method only adds binding if type has not already been added.
+         * @tparam T target for binding
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void try_add_thread_local(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<T, ThreadLocalInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding from Base to Derived type in thread local lifetime with function as instance retrieval.
+         * With this binding given function will be invoked on first retrieval request in each thread
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void add_thread_local(Fn&& fn) // NOLINT short name
+        {
+            add_registration<Base, ThreadLocalInstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Try add binding from Base to Derived type in thread local lifetime with function as instance retrieval.
+         * This method only adds binding if Base type has not already been added.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param fn function to invoke when creating given Base type object, its parameters are injected like constructor arguments
+         */
+        template<class Base, class Derived, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, Derived>, bool> = true>
+        void try_add_thread_local(Fn&& fn) // NOLINT short name
+        {
+            try_add_registration<Base, ThreadLocalInstanceStorage<Derived, FunctionFactory<Derived, std::decay_t<Fn>>>>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding to given type in pooled lifetime (released objects are reused by following requests).
+         * With this binding object is taken from the pool on each retrieval request or constructed if the pool is empty,
+         * it returns to the pool once the last reference to it is released.
+         * Intended for transient objects that are expensive to construct.
+         * @tparam T target for binding
+         * @param capacity maximum number of idle objects kept for reuse, including those kept in caches of each thread
+         * @param reset function invoked on each object when it is returned to the pool, must not throw
+         */
+        template<class T>
+        void add_pooled(std::size_t capacity, const std::function<void(T&)>& reset = nullptr)
+        {
+            add_registration<T, PooledInstanceStorage<T, ConstructorFactory<T>>>(capacity, reset);
+        }
+
+        /**
+         * Try add binding to given type in pooled lifetime (released objects are reused by following requests).
+         * This method only adds given type if it has not already been added.
+         * @tparam T target for binding
+         * @param capacity maximum number of idle objects kept for reuse
+         * @param reset function invoked on each object when it is returned to the pool, must not throw
+         * @see add_pooled
+         */
+        template<class T>
+        void try_add_pooled(std::size_t capacity, const std::function<void(T&)>& reset = nullptr)
+        {
+            try_add_registration<T, PooledInstanceStorage<T, ConstructorFactory<T>>>(capacity, reset);
+        }
+
+        /**
+         * Add binding from Base to Derived type in pooled lifetime (released objects are reused by following requests).
+         * With this binding object is taken from the pool on each retrieval request or constructed if the pool is empty,
+         * it returns to the pool once the last reference to it is released.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param capacity maximum number of idle objects kept for reuse, including those kept in caches of each thread
+         * @param reset function invoked on each object when it is returned to the pool, must not throw
+         */
+        template<class Base, class Derived>
+        void add_pooled(std::size_t capacity, const std::function<void(Derived&)>& reset = nullptr)
+        {
+            add_registration<Base, PooledInstanceStorage<Derived, ConstructorFactory<Derived>>>(capacity, reset);
+        }
+
+        /**
+         * Try add binding from Base to Derived type in pooled lifetime (released objects are reused by following requests).
+         * This method only adds given binding if Base type has not already been added.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param capacity maximum number of idle objects kept for reuse
+         * @param reset function invoked on each object when it is returned to the pool, must not throw
+         * @see add_pooled
+         */
+        template<class Base, class Derived>
+        void try_add_pooled(std::size_t capacity, const std::function<void(Derived&)>& reset = nullptr)
+        {
+            try_add_registration<Base, PooledInstanceStorage<Derived, ConstructorFactory<Derived>>>(capacity, reset);
+        }
+
+        /**
+         * Add binding to given type in cached lifetime (object is reused while it is in use or recently used).
+         * With this binding object is created on first retrieval request and kept until it has been idle for given time
+         * or cache budget requires releasing it, afterwards it lives only as long as it is referenced elsewhere.
+         * Object that is still alive when requested again is reused, otherwise new one is created.
+         * Intended for heavy objects that are rarely used.
+         * @tparam T target for binding
+         * @param idle_timeout time after last retrieval request when object is released by the cache
+         * @param size estimated size of the object counted against cache budget
+         * @see set_cache_budget
+         */
+        template<class T>
+        void add_cached(std::chrono::nanoseconds idle_timeout, std::size_t size = sizeof(T))
+        {
+            add_registration<T, CachedInstanceStorage<T, ConstructorFactory<T>>>(idle_timeout, size);
+        }
+
+        /**
+         * Try to add binding to given type in cached lifetime (object is reused while it is in use or recently used).
+         * This method only adds given type if it has not already been added.
+         * @tparam T target for binding
+         * @param idle_timeout time after last retrieval request when object is released by the cache
+         * @param size estimated size of the object counted against cache budget
+         * @see add_cached
+         */
+        template<class T>
+        void try_add_cached(std::chrono::nanoseconds idle_timeout, std::size_t size = sizeof(T))
+        {
+            try_add_registration<T, CachedInstanceStorage<T, ConstructorFactory<T>>>(idle_timeout, size);
+        }
+
+        /**
+         * Add binding from Base to Derived type in cached lifetime (object is reused while it is in use or recently used).
+         * With this binding object is created on first retrieval request and kept until it has been idle for given time
+         * or cache budget requires releasing it, afterwards it lives only as long as it is referenced elsewhere.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param idle_timeout time after last retrieval request when object is released by the cache
+         * @param size estimated size of the object counted against cache budget
+         * @see set_cache_budget
+         */
+        template<class Base, class Derived>
+        void add_cached(std::chrono::nanoseconds idle_timeout, std::size_t size = sizeof(Derived))
+        {
+            add_registration<Base, CachedInstanceStorage<Derived, ConstructorFactory<Derived>>>(idle_timeout, size);
+        }
+
+        /**
+         * Try to add binding from Base to Derived type in cached lifetime (object is reused while it is in use or recently used).
+         * This method only adds given binding if Base type has not already been added.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param idle_timeout time after last retrieval request when object is released by the cache
+         * @param size estimated size of the object counted against cache budget
+         * @see add_cached
+         */
+        template<class Base, class Derived>
+        void try_add_cached(std::chrono::nanoseconds idle_timeout, std::size_t size = sizeof(Derived))
+        {
+            try_add_registration<Base, CachedInstanceStorage<Derived, ConstructorFactory<Derived>>>(idle_timeout, size);
+        }
+
+        /**
+         * Add binding from Base to Derived type with given object.
+         * With this binding value same object will be returned on each retrieval request.
+         * This effectively makes given binding a binding in singleton scope
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param data value to return when requesting Base type object
+         */
+        template<class Base, class Derived>
+        void add(const std::shared_ptr<Derived>& data)
+        {
+            add_registration<Base, InstanceStorage<Derived, ConstantFactory<Derived, Base>>>(data);
+        }
+
+        /**
+         * Try add binding from Base to Derived type with given object.
+         * This method only adds binding if type has not already been added.
+         * With this binding value same object will be returned on each retrieval request.
+         * This effectively makes given binding a binding in singleton scope
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param data value to return when requesting Base type object
+         */
+        template<class Base, class Derived>
+        void try_add(const std::shared_ptr<Derived>& data)
+        {
+            try_add_registration<Base, InstanceStorage<Derived, ConstantFactory<Derived, Base>>>(data);
+        }
+
+        /**
+         * Add binding to given type under given key, e.g. add<Connection>("replica"_key) or add<Connection>(key<"replica"_hash>).
+         * Keyed bindings are separate from the binding of the type itself and are retrieved with get<T>(key).
+         * Registering binding whose keyed identifier is already used by another type throws ComponentCreationException.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam T target for binding
+         * @param key key to register binding under
+         */
+        template<class T>
+        void add(const Key& key) // NOLINT short name
+        {
+            add_keyed_registration<T, InstanceStorage<T, ConstructorFactory<T>>>(key);
+        }
+
+        /**
+         * Add binding from Base to Derived type under given key.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param key key to register binding under
+         */
+        template<class Base, class Derived>
+        void add(const Key& key) // NOLINT short name
+        {
+            add_keyed_registration<Base, InstanceStorage<Derived, ConstructorFactory<Derived>>>(key);
+        }
+
+        /**
+         * Add binding to given type under given key with function for instance retrieval.
+         * With this binding given function will be invoked on each retrieval request
+         * @tparam T target for binding
+         * @param key key to register binding under
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void add(const Key& key, Fn&& fn) // NOLINT short name
+        {
+            add_keyed_registration<T, InstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(key, std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding from Base to Derived type under given key with given object.
+         * With this binding value same object will be returned on each retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type of given object
+         * @param key key to register binding under
+         * @param data value to return when requesting Base type object
+         */
+        template<class Base, class Derived>
+        void add(const Key& key, const std::shared_ptr<Derived>& data) // NOLINT short name
+        {
+            add_keyed_registration<Base, InstanceStorage<Derived, ConstantFactory<Derived, Base>>>(key, data);
+        }
+
+        /**
+         * Add binding to given type in singleton scope under given key.
+         * Each key holds its own instance, which is created on first retrieval request.
+         * @tparam T target for binding
+         * @param key key to register binding under
+         */
+        template<class T>
+        void add_singleton(const Key& key) // NOLINT short name
+        {
+            add_keyed_registration<T, SingletonInstanceStorage<T, ConstructorFactory<T>>>(key);
+        }
+
+        /**
+         * Add binding from Base to Derived type in singleton scope under given key.
+         * Each key holds its own instance, which is created on first retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param key key to register binding under
+         */
+        template<class Base, class Derived>
+        void add_singleton(const Key& key) // NOLINT short name
+        {
+            add_keyed_registration<Base, SingletonInstanceStorage<Derived, ConstructorFactory<Derived>, Base>>(key);
+        }
+
+        /**
+         * Add binding to given type in singleton scope under given key with function for instance retrieval.
+         * With this binding given function will be invoked only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         * @param key key to register binding under
+         * @param fn function to invoke when creating given type object, its parameters are injected like constructor arguments
+         */
+        template<class T, class Fn, typename std::enable_if_t<detail::is_factory_function_v<Fn, T>, bool> = true>
+        void add_singleton(const Key& key, Fn&& fn) // NOLINT short name
+        {
+            add_keyed_registration<T, SingletonInstanceStorage<T, FunctionFactory<T, std::decay_t<Fn>>>>(key, std::forward<Fn>(fn));
+        }
+
+        /**
+         * Add binding to given type with allocator used for object construction.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam T target for binding
+         * @param allocator allocator created with with_allocator
+         */
+        template<class T, class Allocator>
+        void add(const WithAllocator<Allocator>& allocator) // NOLINT short name
+        {
+            add_registration<T, InstanceStorage<T, ConstructorFactory<T, Allocator>>>(allocator.allocator);
+        }
+
+        /**
+         * Try add binding to given type with allocator used for object construction.
+         * This method only adds given type if it has not already been added.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam T target for binding
+         * @param allocator allocator created with with_allocator
+         */
+        template<class T, class Allocator>
+        void try_add(const WithAllocator<Allocator>& allocator) // NOLINT short name
+        {
+            try_add_registration<T, InstanceStorage<T, ConstructorFactory<T, Allocator>>>(allocator.allocator);
+        }
+
+        /**
+         * Add binding from Base to Derived type with allocator used for object construction.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param allocator allocator created with with_allocator
+         */
+        template<class Base, class Derived, class Allocator>
+        void add(const WithAllocator<Allocator>& allocator) // NOLINT short name
+        {
+            add_registration<Base, InstanceStorage<Derived, ConstructorFactory<Derived, Allocator>>>(allocator.allocator);
+        }
+
+        /**
+         * Try add binding from Base to Derived type with allocator used for object construction.
+         * This method only adds given binding if Base has not already been added.
+         * With this binding given type object will be constructed on each retrieval request.
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param allocator allocator created with with_allocator
+         */
+        template<class Base, class Derived, class Allocator>
+        void try_add(const WithAllocator<Allocator>& allocator) // NOLINT short name
+        {
+            try_add_registration<Base, InstanceStorage<Derived, ConstructorFactory<Derived, Allocator>>>(allocator.allocator);
+        }
+
+        /**
+         * Add binding to given type in singleton scope with allocator used for object construction.
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         * @param allocator allocator created with with_allocator
+         */
+        template<class T, class Allocator>
+        void add_singleton(const WithAllocator<Allocator>& allocator)
+        {
+            add_registration<T, SingletonInstanceStorage<T, ConstructorFactory<T, Allocator>>>(allocator.allocator);
+        }
+
+        /**
+         * Try add binding to given type in singleton scope with allocator used for object construction.
+         * This method only adds given type if it has not already been added.
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam T target for binding
+         * @param allocator allocator created with with_allocator
+         */
+        template<class T, class Allocator>
+        void try_add_singleton(const WithAllocator<Allocator>& allocator)
+        {
+            try_add_registration<T, SingletonInstanceStorage<T, ConstructorFactory<T, Allocator>>>(allocator.allocator);
+        }
+
+        /**
+         * Add binding from Base to Derived type in singleton scope with allocator used for object construction.
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param allocator allocator created with with_allocator
+         */
+        template<class Base, class Derived, class Allocator>
+        void add_singleton(const WithAllocator<Allocator>& allocator)
+        {
+            add_registration<Base, SingletonInstanceStorage<Derived, ConstructorFactory<Derived, Allocator>, Base>>(allocator.allocator);
+        }
+
+        /**
+         * Try add binding from Base to Derived type in singleton scope with allocator used for object construction.
+         * This method only adds given binding if Base type has not already been added.
+         * With this binding given type will be created only on first retrieval request, on subsequent requests it will return same object
+         * @tparam Base base on which binding will be performed
+         * @tparam Derived actual type that will be constructed when requesting Base type
+         * @param allocator allocator created with with_allocator
+         */
+        template<class Base, class Derived, class Allocator>
+        void try_add_singleton(const WithAllocator<Allocator>& allocator)
+        {
+            try_add_registration<Base, SingletonInstanceStorage<Derived, ConstructorFactory<Derived, Allocator>, Base>>(allocator.allocator);
+        }
+
+    protected:
+        Registrar() = default;
+
+    private:
+        template<class Base, class Storage, class... Args>
+        void add_registration(Args&&... args)
+        {
+            register_as<Base, Storage>(type_id<Base>(), false, std::forward<Args>(args)...);
+        }
+
+        template<class Base, class Storage, class... Args>
+        void try_add_registration(Args&&... args)
+        {
+            register_as<Base, Storage>(type_id<Base>(), true, std::forward<Args>(args)...);
+        }
+
+        template<class Base, class Storage, class... Args>
+        void add_keyed_registration(const Key& key, Args&&... args)
+        {
+            register_as<Base, Storage>(keyed_type_id<Base>(key), false, std::forward<Args>(args)...);
+        }
+
+        template<class Base, class Storage, class... Args>
+        void register_as(std::size_t id, bool only_if_absent, Args&&... args)
+        {
+            static_assert(std::is_base_of_v<Base, typename Storage::value_type>, "Cannot bind unrelated types");
+
+            static_cast<Self&>(*this).template add_registration_as<Base, Storage>(id, only_if_absent, std::forward<Args>(args)...);
+        }
+    };
+} // namespace injector
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+
+#include "errors.hpp"
+
+namespace injector
+{
+    /**
+     * Outcome of exception-free retrieval, holds either retrieved object or description of the failure.
+     * @tparam T type of retrieved object
+     */
+    template<class T>
+    class Result
+    {
+    public:
+        Result(std::shared_ptr<T> value) noexcept // NOLINT implicit conversion
+            : m_Value(std::move(value))
+        {
+        }
+
+        Result(const ResolutionError& error) noexcept // NOLINT implicit conversion
+            : m_Error(error)
+        {
+        }
+
+        [[nodiscard]] bool has_value() const noexcept
+        {
+            return m_Value != nullptr;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        /**
+         * @return retrieved object, nullptr if retrieval failed
+         */
+        [[nodiscard]] const std::shared_ptr<T>& value() const& noexcept
+        {
+            return m_Value;
+        }
+
+        [[nodiscard]] std::shared_ptr<T> value() && noexcept
+        {
+            return std::move(m_Value);
+        }
+
+        /**
+         * @return description of the failure, only meaningful when has_value() is false
+         */
+        [[nodiscard]] const ResolutionError& error() const noexcept
+        {
+            return m_Error;
+        }
+
+        T* operator->() const noexcept
+        {
+            return m_Value.get();
+        }
+
+        T& operator*() const noexcept
+        {
+            return *m_Value;
+        }
+
+    private:
+        std::shared_ptr<T> m_Value;
+        ResolutionError m_Error{ErrorCode::CreationFailed, 0};
+    };
+} // namespace injector
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "injector_base.hpp"
+
+namespace injector
+{
+    /**
+     * Unit of work on top of another injector, e.g. a single request.
+     * Registrations are looked up in parent injector, while instances of scoped bindings are cached in the scope
+     * and released in reverse creation order when the scope is destroyed.
+     * Scope is meant to be used by single thread at a time.
+     * Handles and scoped instances refer to the scope they were created in, thus scope cannot be moved,
+     * InjectorBase::create_scope hands it out without a move.
+     */
+    class Scope final : public InjectorBase
+    {
+    public:
+        /**
+         * @param parent injector providing registrations, it must outlive the scope
+         */
+        explicit Scope(InjectorBase& parent) noexcept;
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+        ~Scope() override;
+
+        [[nodiscard]] std::size_t generation() const noexcept override
+        {
+            return m_Parent->generation();
+        }
+
+        [[nodiscard]] detail::PlanCache* plans() noexcept override
+        {
+            return m_Parent->plans();
+        }
+
+        [[nodiscard]] Scope* scope() noexcept override
+        {
+            return this;
+        }
+
+        /**
+         * Retrieve instance cached for given binding or create and cache it.
+         * @tparam T type of cached instance
+         * @param key identity of scoped binding
+         * @param create function creating instance, result is cached only if it is not nullptr
+         * @return cached or newly created instance
+         */
+        template<class T, class Create>
+        std::shared_ptr<T> get_or_create(const void* key, Create&& create)
+        {
+            for (const auto& entry : m_Instances)
+            {
+                if (entry.key == key)
+                {
+                    return std::static_pointer_cast<T>(entry.instance);
+                }
+            }
+
+            std::shared_ptr<T> instance = create(*this);
+
+            if (instance)
+            {
+                m_Instances.push_back({key, instance});
+            }
+
+            return instance;
+        }
+
+    protected:
+        [[nodiscard]] IComponentProvider* find_provider(std::size_t id) const noexcept override
+        {
+            return m_Parent->find_provider(id);
+        }
+
+        [[nodiscard]] ProviderRange find_providers(std::size_t id) const noexcept override
+        {
+            return m_Parent->find_providers(id);
+        }
+
+        [[nodiscard]] std::vector<IComponentProvider*> registered_providers() const override
+        {
+            return m_Parent->registered_providers();
+        }
+
+    private:
+        struct Entry
+        {
+            const void* key;
+            std::shared_ptr<void> instance;
+        };
+
+        InjectorBase* m_Parent;
+        std::vector<Entry> m_Instances;
+    };
+} // namespace injector
+
+#include "injector/detail/scoped_storage.hpp"
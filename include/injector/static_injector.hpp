@@ -0,0 +1,301 @@
+#pragma once
+
+#include <limits>
+#include <optional>
+#include <tuple>
+
+#include "traits.hpp"
+#include "injector/detail/argument_resolver.hpp"
+
+namespace injector
+{
+    /**
+     * Static binding from Base to Derived type that constructs new object on each retrieval request.
+     * Requesting Base returns Derived by value when both types are the same, otherwise std::unique_ptr<Base>.
+     * @tparam Base type on which binding will be performed
+     * @tparam Derived actual type that will be constructed when requesting Base type
+     */
+    template<class Base, class Derived = Base>
+    struct Transient
+    {
+        using base_type = Base;
+        using type = Derived;
+
+        static constexpr bool is_singleton = false;
+    };
+
+    /**
+     * Static binding from Base to Derived type in singleton scope, requesting Base returns Base&.
+     * @tparam Base type on which binding will be performed
+     * @tparam Derived actual type that will be constructed when requesting Base type
+     */
+    template<class Base, class Derived = Base>
+    struct Singleton
+    {
+        using base_type = Base;
+        using type = Derived;
+
+        static constexpr bool is_singleton = true;
+    };
+
+    namespace detail
+    {
+        constexpr std::size_t no_binding = std::numeric_limits<std::size_t>::max();
+
+        // Index of the last binding registered for given type, no_binding if there is none
+        template<class T, class... Bindings>
+        constexpr std::size_t find_binding()
+        {
+            constexpr bool matches[] = {std::is_same_v<T, typename Bindings::base_type>..., false};
+            std::size_t index = no_binding;
+
+            for (std::size_t i = 0; i < sizeof...(Bindings); ++i)
+            {
+                if (matches[i])
+                {
+                    index = i;
+                }
+            }
+
+            return index;
+        }
+
+        template<class Binding>
+        struct static_instance
+        {
+            struct type
+            {
+            };
+        };
+
+        template<class Base, class Derived>
+        struct static_instance<Singleton<Base, Derived>>
+        {
+            using type = std::optional<Derived>;
+        };
+
+        /**
+         * Converts to constructor arguments that given static injector can provide.
+         * Singletons are passed as references, transients as values or std::unique_ptr.
+         * @tparam Injector static injector resolving arguments
+         * @tparam T type whose constructor arguments are resolved
+         */
+        template<class Injector, class T>
+        class StaticArgumentResolver
+        {
+        public:
+            explicit StaticArgumentResolver(Injector& injector) noexcept
+                : m_Injector(std::addressof(injector))
+            {
+            }
+
+            template<class ConstructorArgument, typename std::enable_if_t<!std::is_same_v<std::remove_cv_t<ConstructorArgument>, T> && Injector::template is_singleton_v<std::remove_cv_t<ConstructorArgument>>, bool> = true>
+            operator ConstructorArgument&() const // NOLINT implicit conversion
+            {
+                return m_Injector->template get<std::remove_cv_t<ConstructorArgument>>();
+            }
+
+            template<class ConstructorArgument, typename std::enable_if_t<!std::is_same_v<ConstructorArgument, T> && Injector::template is_transient_v<ConstructorArgument>, bool> = true>
+            operator ConstructorArgument() const // NOLINT implicit conversion
+            {
+                if constexpr (is_unique_v<ConstructorArgument>)
+                {
+                    return m_Injector->template get<typename ConstructorArgument::element_type>();
+                }
+                else
+                {
+                    return m_Injector->template get<ConstructorArgument>();
+                }
+            }
+
+        private:
+            Injector* m_Injector;
+        };
+    } // namespace detail
+
+    /**
+     * Injector with dependency graph fixed at compile time.
+     * Retrieval compiles down to direct constructor calls or references to singletons stored inline,
+     * without any lookups, virtual calls or shared ownership. Missing bindings are reported at compile time.
+     * All singletons are created when injector is constructed, afterwards retrieval is safe from multiple threads.
+     * @tparam Bindings list of Transient and Singleton bindings, later binding for the same type wins
+     */
+    template<class... Bindings>
+    class StaticInjector
+    {
+        template<class T>
+        static constexpr std::size_t binding_index = detail::find_binding<T, Bindings...>();
+
+        template<std::size_t Index>
+        using binding_at = std::tuple_element_t<Index, std::tuple<Bindings...>>;
+
+        template<class T>
+        static constexpr bool is_bound_singleton()
+        {
+            if constexpr (binding_index<T> == detail::no_binding)
+            {
+                return false;
+            }
+            else
+            {
+                return binding_at<binding_index<T>>::is_singleton;
+            }
+        }
+
+        template<class T>
+        static constexpr bool is_bound_transient()
+        {
+            if constexpr (binding_index<T> == detail::no_binding)
+            {
+                return false;
+            }
+            else
+            {
+                return !binding_at<binding_index<T>>::is_singleton;
+            }
+        }
+
+        template<class T>
+        static constexpr bool is_value_transient()
+        {
+            if constexpr (is_bound_transient<T>())
+            {
+                return std::is_same_v<T, typename binding_at<binding_index<T>>::type>;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        template<class T>
+        static constexpr bool is_unique_transient()
+        {
+            if constexpr (is_unique_v<T>)
+            {
+                return is_bound_transient<typename T::element_type>();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+    public:
+        static_assert((std::is_base_of_v<typename Bindings::base_type, typename Bindings::type> && ...), "Cannot bind unrelated types");
+
+        // Whether T can be retrieved as T&
+        template<class T>
+        static constexpr bool is_singleton_v = is_bound_singleton<T>();
+
+        // Whether T can be retrieved by value or as std::unique_ptr
+        template<class T>
+        static constexpr bool is_transient_v = is_unique_transient<T>() || is_value_transient<T>();
+
+        StaticInjector()
+        {
+            (create_singleton<Bindings>(), ...);
+        }
+
+        StaticInjector(const StaticInjector&) = delete;
+        StaticInjector(StaticInjector&&) = delete;
+        StaticInjector& operator=(const StaticInjector&) = delete;
+        StaticInjector& operator=(StaticInjector&&) = delete;
+
+        ~StaticInjector() = default;
+
+        /**
+         * Retrieve object of given type.
+         * @tparam T type to retrieve
+         * @return T& for singleton bindings, T for transient bindings of the type itself, std::unique_ptr<T> for transient bindings from T to derived type
+         */
+        template<class T>
+        decltype(auto) get()
+        {
+            static_assert(binding_index<T> != detail::no_binding, "No binding registered for requested type");
+
+            using binding = binding_at<binding_index<T>>;
+            using instance_type = typename binding::type;
+
+            if constexpr (binding::is_singleton)
+            {
+                return static_cast<T&>(instance<binding>());
+            }
+            else if constexpr (std::is_same_v<T, instance_type>)
+            {
+                return create<instance_type>(std::make_index_sequence<arity<instance_type>>());
+            }
+            else
+            {
+                return std::unique_ptr<T>(create_unique<instance_type>(std::make_index_sequence<arity<instance_type>>()));
+            }
+        }
+
+    private:
+        template<class T>
+        using resolver = detail::StaticArgumentResolver<StaticInjector, T>;
+
+        template<class T>
+        static constexpr std::size_t arity = detail::constructor_arity_v<T, resolver<T>>;
+
+        template<class T, std::size_t Index>
+        resolver<T> make_resolver() noexcept
+        {
+            return resolver<T>(*this);
+        }
+
+        template<class T>
+        static constexpr void check_constructible() noexcept
+        {
+            static_assert(arity<T> != 0 || std::is_default_constructible_v<T>, "No constructor of bound type can be satisfied by registered bindings");
+        }
+
+        template<class T, std::size_t... Indices>
+        T create(std::index_sequence<Indices...> /*indices*/)
+        {
+            check_constructible<T>();
+            return T(make_resolver<T, Indices>()...);
+        }
+
+        template<class T, std::size_t... Indices>
+        T* create_unique(std::index_sequence<Indices...> /*indices*/)
+        {
+            check_constructible<T>();
+            return new T(make_resolver<T, Indices>()...); // NOLINT owned by caller
+        }
+
+        // Singleton instance of given binding, created on first use
+        template<class Binding>
+        auto& instance()
+        {
+            using instance_type = typename Binding::type;
+
+            auto& storage = std::get<binding_index<typename Binding::base_type>>(m_Instances);
+
+            if (!storage)
+            {
+                emplace(storage, std::make_index_sequence<arity<instance_type>>());
+            }
+
+            return *storage;
+        }
+
+        template<class Binding>
+        void create_singleton()
+        {
+            if constexpr (std::is_same_v<Binding, binding_at<binding_index<typename Binding::base_type>>> && Binding::is_singleton)
+            {
+                instance<Binding>();
+            }
+        }
+
+        template<class T, std::size_t... Indices>
+        void emplace(std::optional<T>& storage, std::index_sequence<Indices...> /*indices*/)
+        {
+            check_constructible<T>();
+            storage.emplace(make_resolver<T, Indices>()...);
+        }
+
+        std::tuple<typename detail::static_instance<Bindings>::type...> m_Instances;
+    };
+} // namespace injector
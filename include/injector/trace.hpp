@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace injector
+{
+    namespace detail
+    {
+        class TraceSpan;
+    } // namespace detail
+
+    /**
+     * Records nested trace of every object created by injectors while it is active, e.g. during startup.
+     * Each construction is recorded together with construction that requested it, thus trace follows dependency graph.
+     * Only one trace can be active at a time, when no trace is active recording costs single atomic load per construction.
+     */
+    class ConstructionTrace
+    {
+    public:
+        static constexpr std::size_t no_parent = std::numeric_limits<std::size_t>::max();
+
+        struct Event
+        {
+            // name of constructed type
+            std::string_view name;
+            // index of event that requested this construction, no_parent for top level constructions
+            std::size_t parent;
+            // offsets from the moment trace was started
+            std::chrono::nanoseconds start;
+            std::chrono::nanoseconds end;
+            std::size_t thread;
+        };
+
+        ConstructionTrace() = default;
+
+        ConstructionTrace(const ConstructionTrace&) = delete;
+        ConstructionTrace(ConstructionTrace&&) = delete;
+        ConstructionTrace& operator=(const ConstructionTrace&) = delete;
+        ConstructionTrace& operator=(ConstructionTrace&&) = delete;
+
+        ~ConstructionTrace();
+
+        /**
+         * Start recording constructions instead of currently active trace. Previously recorded events are discarded.
+         * Constructions that are in progress at that moment, even inside factory that restarts trace, are not recorded.
+         * Trace must not be destroyed while constructions started during recording are still in progress.
+         */
+        void start();
+
+        /**
+         * Stop recording, constructions that are still in progress will not be completed in the trace.
+         */
+        void stop() noexcept;
+
+        /**
+         * @return events recorded so far, ordered by start of construction on each thread
+         */
+        [[nodiscard]] std::vector<Event> events() const;
+
+        /**
+         * Write recorded events in Chrome trace event JSON format, viewable in chrome://tracing or Perfetto.
+         * @param stream output stream
+         */
+        void write_chrome_trace(std::ostream& stream) const;
+
+        /**
+         * Write recorded events as folded stacks consumable by flamegraph tools.
+         * Each line contains dependency path and self time of its last construction in nanoseconds.
+         * @param stream output stream
+         */
+        void write_folded_stacks(std::ostream& stream) const;
+
+    private:
+        friend class detail::TraceSpan;
+
+        // Event that is in progress, generation tells recordings of the same trace apart
+        struct Mark
+        {
+            std::size_t event;
+            std::size_t generation;
+        };
+
+        Mark begin(std::string_view name);
+        void end(const Mark& mark);
+
+        [[nodiscard]] std::chrono::nanoseconds now() const noexcept;
+
+        mutable std::mutex m_Mutex;
+        std::chrono::steady_clock::time_point m_Start;
+        // incremented by each start, events recorded before it no longer exist
+        std::size_t m_Generation = 0;
+        std::vector<Event> m_Events;
+    };
+
+    namespace detail
+    {
+        ConstructionTrace* active_trace() noexcept;
+
+        /**
+         * Records construction of single object into active trace for as long as it is alive.
+         */
+        class TraceSpan
+        {
+        public:
+            explicit TraceSpan(std::string_view name)
+                : m_Trace(active_trace())
+            {
+                if (m_Trace)
+                {
+                    m_Mark = m_Trace->begin(name);
+                }
+            }
+
+            TraceSpan(const TraceSpan&) = delete;
+            TraceSpan& operator=(const TraceSpan&) = delete;
+
+            ~TraceSpan()
+            {
+                if (m_Trace)
+                {
+                    m_Trace->end(m_Mark);
+                }
+            }
+
+        private:
+            ConstructionTrace* m_Trace;
+            ConstructionTrace::Mark m_Mark{};
+        };
+    } // namespace detail
+} // namespace injector
@@ -6,6 +6,12 @@
 
 namespace injector
 {
+    template<class T>
+    class Lazy;
+
+    template<class T>
+    class Provider;
+
     template<class T>
     struct is_vector : public std::false_type {};
 
@@ -23,4 +29,26 @@ namespace injector
 
     template<class T>
     constexpr bool is_shared_v = is_shared<T>::value;
+
+    template<class T>
+    struct is_unique : public std::false_type {};
+
+    template<class T>
+    struct is_unique<std::unique_ptr<T>> : public std::true_type {};
+
+    template<class T>
+    constexpr bool is_unique_v = is_unique<T>::value;
+
+    // Handles that are created directly from injector instead of being resolved through a binding
+    template<class T>
+    struct is_handle : public std::false_type {};
+
+    template<class T>
+    struct is_handle<Lazy<T>> : public std::true_type {};
+
+    template<class T>
+    struct is_handle<Provider<T>> : public std::true_type {};
+
+    template<class T>
+    constexpr bool is_handle_v = is_handle<T>::value;
 } // namespace injector
\ No newline at end of file
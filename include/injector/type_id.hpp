@@ -1,26 +1,101 @@
 #pragma once
 
-#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 namespace injector
 {
+    namespace detail
+    {
+        // 64-bit FNV-1a
+        constexpr std::uint64_t hash_string(const char* str, std::size_t length) noexcept
+        {
+            std::uint64_t hash = 14695981039346656037ULL; // NOLINT magic number
+
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                hash ^= static_cast<unsigned char>(str[i]);
+                hash *= 1099511628211ULL; // NOLINT magic number
+            }
+
+            return hash;
+        }
+
+        template<class T>
+        constexpr std::uint64_t type_hash() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return hash_string(__FUNCSIG__, sizeof(__FUNCSIG__) - 1);
+#else
+            return hash_string(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1);
+#endif
+        }
+
+        template<class T>
+        constexpr std::string_view signature() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        // Unique per type even when type names coincide, unlike type_hash it is not usable as stable key
+        template<class T>
+        struct TypeTag
+        {
+            static constexpr char value = 0;
+        };
+
+        template<class T>
+        constexpr const void* type_tag() noexcept
+        {
+            return &TypeTag<T>::value;
+        }
+
+        // Signature of known type tells where type name starts and how much follows it
+        constexpr std::string_view probe_signature = signature<double>();
+        constexpr std::size_t signature_prefix = probe_signature.find("double");
+        constexpr std::size_t signature_suffix = probe_signature.size() - signature_prefix - std::string_view("double").size();
+    } // namespace detail
+
+    /**
+     * Human readable name of given type as spelled by the compiler, intended for diagnostics only.
+     * @tparam T type to name
+     * @return name of given type, views string with static storage duration
+     */
+    template<class T>
+    constexpr std::string_view type_name() noexcept
+    {
+        constexpr auto signature = detail::signature<T>();
+        return signature.substr(detail::signature_prefix, signature.size() - detail::signature_prefix - detail::signature_suffix);
+    }
+
+    /**
+     * Type keys are hashes of fully qualified type names computed at compile time.
+     * They do not depend on order of first use, therefore they are the same between runs and shared libraries.
+     * Distinct types should have distinct names, e.g. same named types in anonymous namespaces of different translation units share key.
+     * Bindings remember exact type they were registered for, thus such clash is reported as KeyCollision instead of mixing the types up.
+     */
     class TypeId
     {
     public:
         template<class T>
-        static std::size_t id() noexcept
+        static constexpr std::size_t id() noexcept
         {
-            static const auto id = s_LastIndex.fetch_add(1, std::memory_order_relaxed); // NOLINT short name
-            return id;
+            return s_Id<T>;
         }
 
     private:
-        static std::atomic<std::size_t> s_LastIndex; // NOLINT non const variable
+        template<class T>
+        static constexpr auto s_Id = static_cast<std::size_t>(detail::type_hash<T>());
     };
 
     template<class T>
-    std::size_t type_id() noexcept
+    constexpr std::size_t type_id() noexcept
     {
         return TypeId::id<T>();
     }
-} // namespace injector
\ No newline at end of file
+} // namespace injector
@@ -0,0 +1,187 @@
+#include "injector/detail/cached_storage.hpp"
+
+#include <vector>
+
+namespace injector::detail
+{
+    // Entries currently holding their objects, ordered from most to least recently used
+    class CacheRegistry
+    {
+    public:
+        static CacheRegistry& instance()
+        {
+            static CacheRegistry registry;
+            return registry;
+        }
+
+        void touch(CacheEntry& entry, std::shared_ptr<void> instance, CacheEntry::clock::time_point now)
+        {
+            std::vector<std::shared_ptr<void>> released;
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                const bool kept = entry.m_Instance != nullptr;
+
+                if (kept)
+                {
+                    unlink(entry);
+                }
+
+                // previously kept object is the same one unless it has been released meanwhile
+                entry.m_Instance = std::move(instance);
+                entry.m_Touched.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+                link_front(entry);
+
+                // moving entry within the list neither adds size nor makes other entries idle sooner
+                if (!kept)
+                {
+                    evict(now, &entry, released);
+                }
+            }
+        }
+
+        void remove(CacheEntry& entry)
+        {
+            std::shared_ptr<void> released;
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+
+                if (entry.m_Instance)
+                {
+                    unlink(entry);
+                    released = std::move(entry.m_Instance);
+                }
+            }
+        }
+
+        void set_budget(std::size_t bytes)
+        {
+            std::vector<std::shared_ptr<void>> released;
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Budget = bytes;
+                evict(std::chrono::steady_clock::now(), nullptr, released);
+            }
+        }
+
+        void trim()
+        {
+            std::vector<std::shared_ptr<void>> released;
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                evict(std::chrono::steady_clock::now(), nullptr, released);
+            }
+        }
+
+    private:
+        // Objects are destroyed by the caller once the lock is released
+        void evict(std::chrono::steady_clock::time_point now, CacheEntry* keep, std::vector<std::shared_ptr<void>>& released)
+        {
+            for (auto* entry = m_Head; entry;)
+            {
+                auto* next = entry->m_Next;
+
+                const CacheEntry::clock::time_point last_use(CacheEntry::clock::duration(entry->m_LastUse.load(std::memory_order_relaxed)));
+
+                if (entry != keep && now - last_use > entry->m_IdleTimeout)
+                {
+                    release(*entry, released);
+                }
+
+                entry = next;
+            }
+
+            while (m_Size > m_Budget && m_Tail && m_Tail != keep)
+            {
+                release(*m_Tail, released);
+            }
+        }
+
+        void release(CacheEntry& entry, std::vector<std::shared_ptr<void>>& released)
+        {
+            unlink(entry);
+            released.push_back(std::move(entry.m_Instance));
+        }
+
+        void link_front(CacheEntry& entry) noexcept
+        {
+            entry.m_Previous = nullptr;
+            entry.m_Next = m_Head;
+
+            if (m_Head)
+            {
+                m_Head->m_Previous = &entry;
+            }
+            else
+            {
+                m_Tail = &entry;
+            }
+
+            m_Head = &entry;
+            m_Size += entry.m_Size;
+            entry.m_Kept.store(true, std::memory_order_relaxed);
+        }
+
+        void unlink(CacheEntry& entry) noexcept
+        {
+            (entry.m_Previous ? entry.m_Previous->m_Next : m_Head) = entry.m_Next;
+            (entry.m_Next ? entry.m_Next->m_Previous : m_Tail) = entry.m_Previous;
+
+            entry.m_Previous = nullptr;
+            entry.m_Next = nullptr;
+            m_Size -= entry.m_Size;
+            entry.m_Kept.store(false, std::memory_order_relaxed);
+        }
+
+        std::mutex m_Mutex;
+        CacheEntry* m_Head = nullptr;
+        CacheEntry* m_Tail = nullptr;
+        std::size_t m_Size = 0;
+        std::size_t m_Budget = std::numeric_limits<std::size_t>::max();
+    };
+
+    // Registry is created before first entry, thus it outlives entries of injectors with static storage duration
+    CacheEntry::CacheEntry(std::chrono::nanoseconds idle_timeout, std::size_t size)
+        : m_IdleTimeout(idle_timeout),
+          m_Size(size)
+    {
+        CacheRegistry::instance();
+    }
+
+    CacheEntry::~CacheEntry()
+    {
+        CacheRegistry::instance().remove(*this);
+    }
+
+    void CacheEntry::touch(std::shared_ptr<void> instance)
+    {
+        const auto now = clock::now();
+        m_LastUse.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+
+        // kept object is the same one, thus entry only moves to the front once it has been at its position for a while
+        const clock::time_point touched(clock::duration(m_Touched.load(std::memory_order_relaxed)));
+
+        if (m_Kept.load(std::memory_order_relaxed) && now - touched < touch_interval)
+        {
+            return;
+        }
+
+        CacheRegistry::instance().touch(*this, std::move(instance), now);
+    }
+} // namespace injector::detail
+
+namespace injector
+{
+    void set_cache_budget(std::size_t bytes)
+    {
+        detail::CacheRegistry::instance().set_budget(bytes);
+    }
+
+    void trim_cache()
+    {
+        detail::CacheRegistry::instance().trim();
+    }
+} // namespace injector
@@ -0,0 +1,56 @@
+#include "injector/child_injector.hpp"
+
+#include <algorithm>
+
+namespace injector
+{
+    ChildInjector InjectorBase::create_child()
+    {
+        return ChildInjector(*this);
+    }
+
+    ChildInjector::ChildInjector(InjectorBase& parent) noexcept
+        : m_Parent(std::addressof(parent)),
+          m_ParentGeneration(parent.generation()),
+          m_InheritedGeneration(next_generation())
+    {
+    }
+
+    std::size_t ChildInjector::generation() const noexcept
+    {
+        const auto parent_generation = m_Parent->generation();
+
+        // registrations of the parent changed, plans compiled against this child are no longer valid either.
+        // Inherited generation is replaced before parent generation is recorded, so thread that observes
+        // recorded parent generation also observes the replaced inherited one and never reuses stale plan
+        if (m_ParentGeneration.load(std::memory_order_acquire) != parent_generation)
+        {
+            m_InheritedGeneration.store(next_generation(), std::memory_order_release);
+            m_ParentGeneration.store(parent_generation, std::memory_order_release);
+        }
+
+        // both values come from the same monotonic counter, thus the larger one changes whenever either of them does
+        return std::max(Injector::generation(), m_InheritedGeneration.load(std::memory_order_acquire));
+    }
+
+    void ChildInjector::add_providers(detail::PendingRegistrations&& registrations)
+    {
+        // try_add family and identifier checks also respect bindings of the parent, own bindings are checked while inserting
+        for (std::size_t i = 0; i < registrations.size(); ++i)
+        {
+            auto* inherited = m_Parent->find_provider(registrations.ids[i]);
+
+            if (const auto& provider = registrations.providers[i])
+            {
+                check_identifier(provider->dependency_node().type, provider->type_tag(), inherited);
+            }
+
+            if (registrations.only_if_absent[i] && inherited)
+            {
+                registrations.providers[i].reset();
+            }
+        }
+
+        Injector::add_providers(std::move(registrations));
+    }
+} // namespace injector
@@ -0,0 +1,128 @@
+#include "injector/concurrent_injector.hpp"
+
+#include <algorithm>
+
+namespace injector
+{
+    ConcurrentInjector::Table::Table(unsigned bits)
+        : shift(64 - bits),
+          mask((std::size_t(1) << bits) - 1),
+          slots(std::make_unique<Slot[]>(std::size_t(1) << bits)) // NOLINT c array
+    {
+    }
+
+    ConcurrentInjector::ConcurrentInjector()
+    {
+        constexpr unsigned initial_bits = 4;
+
+        m_Tables.push_back(std::make_unique<Table>(initial_bits));
+        m_Table.store(m_Tables.back().get(), std::memory_order_release);
+    }
+
+    std::vector<IComponentProvider*> ConcurrentInjector::registered_providers() const
+    {
+        std::lock_guard<std::mutex> lock(m_WriteMutex);
+        return Injector::registered_providers();
+    }
+
+    void ConcurrentInjector::add_provider(std::size_t id, std::unique_ptr<IComponentProvider>&& provider)
+    {
+        std::lock_guard<std::mutex> lock(m_WriteMutex);
+
+        Injector::add_provider(id, std::move(provider));
+        publish(id);
+    }
+
+    void ConcurrentInjector::add_providers(detail::PendingRegistrations&& pending)
+    {
+        std::lock_guard<std::mutex> lock(m_WriteMutex);
+
+        const auto ids = pending.ids;
+        Injector::add_providers(std::move(pending));
+
+        for (auto id : ids)
+        {
+            publish(id);
+        }
+    }
+
+    void ConcurrentInjector::publish(std::size_t id)
+    {
+        auto it = registrations().find(id); // NOLINT short name
+
+        if (it == registrations().end())
+        {
+            return;
+        }
+
+        const auto& providers = it->second;
+        auto& blocks = m_Blocks[id];
+
+        if (providers.size() == blocks.size)
+        {
+            return;
+        }
+
+        // readers keep using superseded block, therefore growing one copies it instead of reallocating
+        if (providers.size() > blocks.capacity)
+        {
+            blocks.capacity = std::max(blocks.capacity * 2, providers.size());
+            blocks.blocks.push_back(std::make_unique<IComponentProvider*[]>(blocks.capacity)); // NOLINT c array
+            blocks.size = 0;
+        }
+
+        auto* data = blocks.blocks.back().get();
+        std::copy(providers.begin() + blocks.size, providers.end(), data + blocks.size);
+        blocks.size = providers.size();
+
+        m_Published.push_back(std::make_unique<const Published>(Published{data, blocks.size}));
+        insert(id, m_Published.back().get());
+    }
+
+    void ConcurrentInjector::insert(std::size_t id, const Published* providers)
+    {
+        auto* table = m_Table.load(std::memory_order_relaxed);
+
+        if ((table->count + 1) * 2 > table->mask + 1)
+        {
+            auto grown = std::make_unique<Table>(64 - table->shift + 1);
+
+            for (std::size_t i = 0; i <= table->mask; ++i)
+            {
+                if (const auto* existing = table->slots[i].providers.load(std::memory_order_relaxed))
+                {
+                    store(*grown, table->slots[i].id.load(std::memory_order_relaxed), existing);
+                }
+            }
+
+            // superseded table may still be probed by readers, it is kept until injector is destroyed
+            m_Tables.push_back(std::move(grown));
+            table = m_Tables.back().get();
+            m_Table.store(table, std::memory_order_release);
+        }
+
+        store(*table, id, providers);
+    }
+
+    void ConcurrentInjector::store(Table& table, std::size_t id, const Published* providers) noexcept
+    {
+        for (auto index = table.index_of(id);; index = (index + 1) & table.mask)
+        {
+            auto& slot = table.slots[index];
+
+            if (!slot.providers.load(std::memory_order_relaxed))
+            {
+                slot.id.store(id, std::memory_order_relaxed);
+                slot.providers.store(providers, std::memory_order_release);
+                ++table.count;
+                return;
+            }
+
+            if (slot.id.load(std::memory_order_relaxed) == id)
+            {
+                slot.providers.store(providers, std::memory_order_release);
+                return;
+            }
+        }
+    }
+} // namespace injector
@@ -0,0 +1,97 @@
+#include "injector/frozen_injector.hpp"
+
+namespace injector
+{
+    FrozenInjector::FrozenInjector(Injector&& injector)
+        : InjectorBase(std::move(injector)),
+          m_Providers(std::move(injector.m_Providers))
+    {
+        const auto& registrations = injector.m_Registrations;
+
+        allocate(registrations.size());
+        m_Index.reserve(m_Providers.size());
+        adopt_providers();
+
+        for (const auto& [id, providers] : registrations)
+        {
+            auto index = slot_index(id);
+
+            while (m_Slots[index].provider)
+            {
+                index = (index + 1) & m_Mask;
+            }
+
+            auto& slot = m_Slots[index];
+            slot.id = id;
+            slot.provider = providers.back();
+            slot.first = static_cast<std::uint32_t>(m_Index.size());
+            slot.count = static_cast<std::uint32_t>(providers.size());
+
+            m_Index.insert(m_Index.end(), providers.begin(), providers.end());
+        }
+
+        injector.m_Registrations.clear();
+        injector.m_Providers.clear();
+    }
+
+    FrozenInjector::FrozenInjector(FrozenInjector&& other)
+        : InjectorBase(std::move(other)),
+          m_Slots(std::move(other.m_Slots)),
+          m_Shift(other.m_Shift),
+          m_Mask(other.m_Mask),
+          m_Index(std::move(other.m_Index)),
+          m_Providers(std::move(other.m_Providers)),
+          m_Plans(std::move(other.m_Plans))
+    {
+        adopt_providers();
+
+        // moved from injector stays queryable, it just has no registrations
+        other.m_Index.clear();
+        other.m_Providers.clear();
+        other.allocate(0);
+    }
+
+    FrozenInjector& FrozenInjector::operator=(FrozenInjector&& other)
+    {
+        if (this != &other)
+        {
+            InjectorBase::operator=(std::move(other));
+            m_Slots = std::move(other.m_Slots);
+            m_Shift = other.m_Shift;
+            m_Mask = other.m_Mask;
+            m_Index = std::move(other.m_Index);
+            m_Providers = std::move(other.m_Providers);
+            m_Plans = std::move(other.m_Plans);
+            adopt_providers();
+
+            other.m_Index.clear();
+            other.m_Providers.clear();
+            other.allocate(0);
+        }
+
+        return *this;
+    }
+
+    void FrozenInjector::allocate(std::size_t keys)
+    {
+        // at least twice as many slots as keys, size does not depend on how well the ids spread
+        unsigned bits = 1;
+
+        while ((std::size_t(1) << bits) < keys * 2)
+        {
+            ++bits;
+        }
+
+        m_Shift = 64 - bits;
+        m_Mask = (std::size_t(1) << bits) - 1;
+        m_Slots.assign(std::size_t(1) << bits, Slot());
+    }
+
+    void FrozenInjector::adopt_providers() noexcept
+    {
+        for (const auto& provider : m_Providers)
+        {
+            provider->set_owner(this);
+        }
+    }
+} // namespace injector
@@ -0,0 +1,69 @@
+#include "injector/injector.hpp"
+
+namespace injector
+{
+    Injector::Injector(Injector&& other)
+        : InjectorBase(std::move(other)),
+          m_Registrations(std::move(other.m_Registrations)),
+          m_Providers(std::move(other.m_Providers)),
+          m_Plans(std::move(other.m_Plans))
+    {
+        for (const auto& provider : m_Providers)
+        {
+            provider->set_owner(this);
+        }
+    }
+
+    Injector& Injector::operator=(Injector&& other)
+    {
+        InjectorBase::operator=(std::move(other));
+        m_Registrations = std::move(other.m_Registrations);
+        m_Providers = std::move(other.m_Providers);
+        m_Plans = std::move(other.m_Plans);
+
+        for (const auto& provider : m_Providers)
+        {
+            provider->set_owner(this);
+        }
+
+        return *this;
+    }
+
+    FrozenInjector Injector::freeze()
+    {
+        return FrozenInjector(std::move(*this));
+    }
+
+    void Injector::add_providers(detail::PendingRegistrations&& registrations)
+    {
+        m_Registrations.reserve(m_Registrations.size() + registrations.size());
+        m_Providers.reserve(m_Providers.size() + registrations.size());
+
+        for (std::size_t i = 0; i < registrations.size(); ++i)
+        {
+            auto& provider = registrations.providers[i];
+
+            if (!provider)
+            {
+                continue;
+            }
+
+            auto [entry, inserted] = m_Registrations.try_emplace(registrations.ids[i]);
+            auto& providers = entry->second;
+
+            if (!inserted)
+            {
+                check_identifier(provider->dependency_node().type, provider->type_tag(), providers.back());
+            }
+
+            if (registrations.only_if_absent[i] && !providers.empty())
+            {
+                continue;
+            }
+
+            provider->set_owner(this);
+            providers.push_back(provider.get());
+            m_Providers.push_back(std::move(provider));
+        }
+    }
+} // namespace injector
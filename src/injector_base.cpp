@@ -0,0 +1,408 @@
+#include "injector/injector_base.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace injector
+{
+    std::size_t InjectorBase::next_generation() noexcept
+    {
+        static std::atomic<std::size_t> generation = 0;
+        return generation.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    void InjectorBase::warm_up(const Executor& executor)
+    {
+        std::vector<IComponentProvider*> singletons;
+
+        for (auto* provider : registered_providers())
+        {
+            if (provider->is_singleton())
+            {
+                singletons.push_back(provider);
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::size_t remaining = singletons.size();
+#if INJECTOR_HAS_EXCEPTIONS
+        std::exception_ptr error;
+#else
+        std::size_t failures = 0;
+#endif
+
+        for (auto* provider : singletons)
+        {
+            executor([&, provider] {
+#if INJECTOR_HAS_EXCEPTIONS
+                std::exception_ptr task_error;
+
+                try
+                {
+                    if (!provider->instantiate(*this))
+                    {
+                        throw ComponentCreationException();
+                    }
+                }
+                catch (...)
+                {
+                    task_error = std::current_exception();
+                }
+#else
+                const bool failed = !provider->instantiate(*this);
+#endif
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+#if INJECTOR_HAS_EXCEPTIONS
+                if (task_error && !error)
+                {
+                    error = task_error;
+                }
+#else
+                failures += failed ? 1 : 0;
+#endif
+
+                if (--remaining == 0)
+                {
+                    finished.notify_all();
+                }
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] {
+            return remaining == 0;
+        });
+
+#if INJECTOR_HAS_EXCEPTIONS
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+#else
+        if (failures != 0)
+        {
+            detail::raise({ErrorCode::CreationFailed, 0});
+        }
+#endif
+    }
+
+    void InjectorBase::warm_up()
+    {
+        warm_up([](const std::function<void()>& task) {
+            task();
+        });
+    }
+
+    void InjectorBase::prefetch(const detail::DependencyTable& dependencies, const Executor& executor)
+    {
+        // Task is run by whoever claims it first, either executor or thread waiting for the batch
+        struct Task
+        {
+            IComponentProvider* provider = nullptr;
+            std::atomic<bool> claimed = false;
+        };
+
+        struct Batch
+        {
+            explicit Batch(std::size_t size)
+                : tasks(std::make_unique<Task[]>(size)),
+                  remaining(size)
+            {
+            }
+
+            std::unique_ptr<Task[]> tasks;
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::size_t remaining;
+#if INJECTOR_HAS_EXCEPTIONS
+            std::exception_ptr error;
+#endif
+        };
+
+        std::vector<IComponentProvider*> singletons;
+
+        const auto add_singleton = [&singletons](IComponentProvider* provider) {
+            if (std::find(singletons.begin(), singletons.end(), provider) == singletons.end())
+            {
+                singletons.push_back(provider);
+            }
+        };
+
+        for (const auto& dependency : dependencies.arguments)
+        {
+            if (dependency.kind == detail::DependencyKind::Deferred)
+            {
+                continue;
+            }
+
+            if (dependency.kind == detail::DependencyKind::Multiple)
+            {
+                for (auto* provider : find_providers(dependency.type))
+                {
+                    if (provider->is_singleton())
+                    {
+                        add_singleton(provider);
+                    }
+                }
+            }
+            else if (auto* provider = find_provider(dependency.type))
+            {
+                if (provider->is_singleton())
+                {
+                    add_singleton(provider);
+                }
+                else
+                {
+                    // transient dependency is created together with its dependant, only its own dependencies are prefetched
+                    prefetch(*provider->dependency_node().dependencies, executor);
+                }
+            }
+            else if (dependency.implicit)
+            {
+                prefetch(*dependency.implicit(), executor);
+            }
+        }
+
+        if (singletons.empty())
+        {
+            return;
+        }
+
+        auto batch = std::make_shared<Batch>(singletons.size());
+
+        const auto run = [this, executor](Batch& batch, Task& task) {
+            if (task.claimed.exchange(true, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+#if INJECTOR_HAS_EXCEPTIONS
+            std::exception_ptr task_error;
+
+            try
+            {
+                prefetch(*task.provider->dependency_node().dependencies, executor);
+                task.provider->instantiate(*this);
+            }
+            catch (...)
+            {
+                task_error = std::current_exception();
+            }
+#else
+            prefetch(*task.provider->dependency_node().dependencies, executor);
+            task.provider->instantiate(*this);
+#endif
+
+            std::lock_guard<std::mutex> lock(batch.mutex);
+
+#if INJECTOR_HAS_EXCEPTIONS
+            if (task_error && !batch.error)
+            {
+                batch.error = task_error;
+            }
+#endif
+
+            if (--batch.remaining == 0)
+            {
+                batch.finished.notify_all();
+            }
+        };
+
+        for (std::size_t i = 0; i < singletons.size(); ++i)
+        {
+            batch->tasks[i].provider = singletons[i];
+        }
+
+        // first task is always run by this thread, there is no need to schedule it
+        for (std::size_t i = 1; i < singletons.size(); ++i)
+        {
+            executor([batch, run, i] {
+                run(*batch, batch->tasks[i]);
+            });
+        }
+
+        for (std::size_t i = 0; i < singletons.size(); ++i)
+        {
+            run(*batch, batch->tasks[i]);
+        }
+
+        std::unique_lock<std::mutex> lock(batch->mutex);
+        batch->finished.wait(lock, [&] {
+            return batch->remaining == 0;
+        });
+
+#if INJECTOR_HAS_EXCEPTIONS
+        if (batch->error)
+        {
+            std::rethrow_exception(batch->error);
+        }
+#endif
+    }
+
+    std::vector<BindingMetrics> InjectorBase::metrics() const
+    {
+        std::vector<BindingMetrics> result;
+
+#if INJECTOR_ENABLE_METRICS
+        for (const auto* provider : registered_providers())
+        {
+            result.push_back(provider->metrics());
+        }
+#endif
+
+        return result;
+    }
+
+    /*
+     * Depth first walk over bindings, and over types without binding that get constructed directly.
+     * Walk made before resolution stops at first problem and skips deferred dependencies, they are only resolved when used.
+     */
+    class InjectorBase::Validator
+    {
+    public:
+        Validator(const InjectorBase& injector, bool resolution) noexcept
+            : m_Injector(injector),
+              m_Resolution(resolution)
+        {
+        }
+
+        void visit(const void* key, const detail::DependencyNode& node)
+        {
+            if (m_Resolution && !errors.empty())
+            {
+                return;
+            }
+
+            if (auto state = m_States.find(key); state != m_States.end())
+            {
+                if (state->second == State::Visiting)
+                {
+                    report(ErrorCode::Cycle, node.type, node.name);
+                }
+
+                return;
+            }
+
+            m_States.emplace(key, State::Visiting);
+            m_Path.push_back(node.name);
+
+            if (!node.dependencies->constructible)
+            {
+                report(ErrorCode::CreationFailed, node.type, {});
+            }
+
+            for (const auto& dependency : node.dependencies->arguments)
+            {
+                visit(dependency);
+            }
+
+            m_Path.pop_back();
+            m_States[key] = State::Visited;
+        }
+
+        void visit(IComponentProvider* provider)
+        {
+            visit(provider, provider->dependency_node());
+        }
+
+        std::vector<ValidationError> errors;
+
+    private:
+        enum class State
+        {
+            Visiting,
+            Visited
+        };
+
+        void visit(const detail::Dependency& dependency)
+        {
+            if (m_Resolution && dependency.kind == detail::DependencyKind::Deferred)
+            {
+                return;
+            }
+
+            if (dependency.kind == detail::DependencyKind::Multiple)
+            {
+                for (auto* provider : m_Injector.find_providers(dependency.type))
+                {
+                    visit(provider);
+                }
+
+                return;
+            }
+
+            auto* provider = m_Injector.find_provider(dependency.type);
+
+            if (!provider && !dependency.implicit)
+            {
+                report(ErrorCode::Unbound, dependency.type, dependency.name);
+            }
+            else if (dependency.kind == detail::DependencyKind::Exclusive && provider && provider->constructed_type() == 0)
+            {
+                report(ErrorCode::NotTransient, dependency.type, dependency.name);
+            }
+            else if (dependency.kind != detail::DependencyKind::Deferred)
+            {
+                if (provider)
+                {
+                    visit(provider);
+                }
+                else
+                {
+                    const auto* dependencies = dependency.implicit();
+                    visit(dependencies, {dependency.type, dependency.name, dependencies});
+                }
+            }
+        }
+
+        // Failing type is appended to current path unless it is already its last element
+        void report(ErrorCode code, std::size_t type, std::string_view name)
+        {
+            auto& error = errors.emplace_back(ValidationError{code, type, m_Path});
+
+            if (!name.empty())
+            {
+                error.path.push_back(name);
+            }
+        }
+
+        const InjectorBase& m_Injector;
+        bool m_Resolution;
+        std::unordered_map<const void*, State> m_States;
+        std::vector<std::string_view> m_Path;
+    };
+
+    std::vector<ValidationError> InjectorBase::validate() const
+    {
+        Validator validator(*this, false);
+
+        for (auto* provider : registered_providers())
+        {
+            validator.visit(provider);
+        }
+
+        return std::move(validator.errors);
+    }
+
+    bool InjectorBase::check_dependencies(const detail::DependencyTable* dependencies) const
+    {
+        Validator validator(*this, true);
+        validator.visit(dependencies, {0, {}, dependencies});
+
+        if (validator.errors.empty())
+        {
+            return true;
+        }
+
+        const auto& error = validator.errors.front();
+        detail::raise({error.code, error.type});
+        return false;
+    }
+} // namespace injector
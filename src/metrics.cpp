@@ -0,0 +1,22 @@
+#include "injector/metrics.hpp"
+
+namespace injector
+{
+    namespace
+    {
+        std::atomic<ResolutionObserver*> observer = nullptr;
+    } // namespace
+
+    void set_resolution_observer(ResolutionObserver* resolution_observer) noexcept
+    {
+        observer.store(resolution_observer, std::memory_order_release);
+    }
+
+    namespace detail
+    {
+        ResolutionObserver* resolution_observer() noexcept
+        {
+            return observer.load(std::memory_order_acquire);
+        }
+    } // namespace detail
+} // namespace injector
@@ -0,0 +1,72 @@
+#include "injector/detail/resolution_plan.hpp"
+
+namespace injector::detail
+{
+    PlanCache::PlanCache(PlanCache&& other) noexcept
+    {
+        for (std::size_t i = 0; i < chunk_count; ++i)
+        {
+            m_Chunks[i].store(other.m_Chunks[i].exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    PlanCache& PlanCache::operator=(PlanCache&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+
+            for (std::size_t i = 0; i < chunk_count; ++i)
+            {
+                m_Chunks[i].store(other.m_Chunks[i].exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+        }
+
+        return *this;
+    }
+
+    PlanCache::~PlanCache()
+    {
+        clear();
+    }
+
+    PlanCache::Chunk& PlanCache::chunk(std::size_t index)
+    {
+        auto& slot = m_Chunks[index];
+        auto* chunk = slot.load(std::memory_order_acquire);
+
+        if (!chunk)
+        {
+            auto created = std::make_unique<Chunk>();
+
+            if (slot.compare_exchange_strong(chunk, created.get(), std::memory_order_acq_rel))
+            {
+                chunk = created.release();
+            }
+        }
+
+        return *chunk;
+    }
+
+    void PlanCache::clear() noexcept
+    {
+        for (auto& slot : m_Chunks)
+        {
+            std::unique_ptr<Chunk> chunk(slot.exchange(nullptr, std::memory_order_relaxed));
+
+            if (chunk)
+            {
+                for (auto& entry : chunk->entries)
+                {
+                    delete entry.load(std::memory_order_relaxed); // NOLINT owned by the cache
+                }
+            }
+        }
+    }
+
+    std::size_t next_plan_index() noexcept
+    {
+        static std::atomic<std::size_t> index = 0;
+        return index.fetch_add(1, std::memory_order_relaxed);
+    }
+} // namespace injector::detail
@@ -0,0 +1,23 @@
+#include "injector/scope.hpp"
+
+namespace injector
+{
+    Scope InjectorBase::create_scope()
+    {
+        return Scope(*this);
+    }
+
+    Scope::Scope(InjectorBase& parent) noexcept
+        : m_Parent(std::addressof(parent))
+    {
+    }
+
+    Scope::~Scope()
+    {
+        // dependencies are created before their dependants, therefore release them last
+        while (!m_Instances.empty())
+        {
+            m_Instances.pop_back();
+        }
+    }
+} // namespace injector
@@ -0,0 +1,79 @@
+#include "injector/detail/thread_local_storage.hpp"
+
+#include <mutex>
+
+namespace injector::detail
+{
+    namespace
+    {
+        struct SlotRegistry
+        {
+            std::mutex mutex;
+            std::vector<std::size_t> released;
+            std::size_t next_index = 0;
+            std::uint64_t next_version = 1;
+        };
+
+        SlotRegistry& slot_registry()
+        {
+            static SlotRegistry registry;
+            return registry;
+        }
+    } // namespace
+
+    ThreadLocalSlot::ThreadLocalSlot()
+    {
+        auto& registry = slot_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        if (registry.released.empty())
+        {
+            m_Index = registry.next_index++;
+        }
+        else
+        {
+            m_Index = registry.released.back();
+            registry.released.pop_back();
+        }
+
+        m_Version = registry.next_version++;
+    }
+
+    ThreadLocalSlot::~ThreadLocalSlot()
+    {
+        if (!m_Released)
+        {
+            release();
+        }
+    }
+
+    void ThreadLocalSlot::release()
+    {
+        auto& registry = slot_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        registry.released.push_back(m_Index);
+        m_Released = true;
+    }
+
+    bool ThreadLocalSlot::store(std::shared_ptr<void> instance) const
+    {
+        auto* cells = thread_local_cells();
+
+        if (!cells)
+        {
+            return false;
+        }
+
+        if (m_Index >= cells->size())
+        {
+            cells->resize(m_Index + 1);
+        }
+
+        // cell may still hold instance of released slot, it is destroyed here
+        (*cells)[m_Index].version = m_Version;
+        (*cells)[m_Index].instance = std::move(instance);
+
+        return true;
+    }
+} // namespace injector::detail
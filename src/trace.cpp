@@ -0,0 +1,192 @@
+#include "injector/trace.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace injector
+{
+    namespace
+    {
+        std::atomic<ConstructionTrace*> active = nullptr;
+
+        struct OpenEvent
+        {
+            const ConstructionTrace* trace;
+            std::size_t generation;
+            std::size_t event;
+        };
+
+        // Events that are in progress on current thread, innermost last
+        // They may belong to another trace or to recording that was restarted since, such events are never parents
+        std::vector<OpenEvent>& open_events()
+        {
+            static thread_local std::vector<OpenEvent> events;
+            return events;
+        }
+
+        void write_escaped(std::ostream& stream, std::string_view text)
+        {
+            for (char character : text)
+            {
+                if (character == '"' || character == '\\')
+                {
+                    stream << '\\';
+                }
+
+                stream << character;
+            }
+        }
+
+        double microseconds(std::chrono::nanoseconds duration)
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+    } // namespace
+
+    ConstructionTrace::~ConstructionTrace()
+    {
+        stop();
+    }
+
+    void ConstructionTrace::start()
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Events.clear();
+            ++m_Generation;
+            m_Start = std::chrono::steady_clock::now();
+        }
+
+        active.store(this, std::memory_order_release);
+    }
+
+    void ConstructionTrace::stop() noexcept
+    {
+        auto* expected = this;
+        active.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+
+    std::vector<ConstructionTrace::Event> ConstructionTrace::events() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Events;
+    }
+
+    void ConstructionTrace::write_chrome_trace(std::ostream& stream) const
+    {
+        const auto events = this->events();
+
+        stream << "{\"traceEvents\":[";
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            const auto& event = events[i];
+
+            if (i != 0)
+            {
+                stream << ',';
+            }
+
+            stream << "{\"name\":\"";
+            write_escaped(stream, event.name);
+            stream << "\",\"cat\":\"injector\",\"ph\":\"X\",\"ts\":" << microseconds(event.start)
+                   << ",\"dur\":" << microseconds(event.end - event.start)
+                   << ",\"pid\":1,\"tid\":" << event.thread
+                   << ",\"args\":{\"parent\":\"";
+
+            if (event.parent != no_parent)
+            {
+                write_escaped(stream, events[event.parent].name);
+            }
+
+            stream << "\"}}";
+        }
+
+        stream << "]}\n";
+    }
+
+    void ConstructionTrace::write_folded_stacks(std::ostream& stream) const
+    {
+        const auto events = this->events();
+        std::vector<std::chrono::nanoseconds> self_time(events.size());
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            self_time[i] += events[i].end - events[i].start;
+
+            if (events[i].parent != no_parent)
+            {
+                self_time[events[i].parent] -= events[i].end - events[i].start;
+            }
+        }
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            std::string stack(events[i].name);
+
+            for (auto parent = events[i].parent; parent != no_parent; parent = events[parent].parent)
+            {
+                stack.insert(0, ";").insert(0, events[parent].name);
+            }
+
+            stream << stack << ' ' << std::max(self_time[i].count(), std::chrono::nanoseconds::rep(0)) << '\n';
+        }
+    }
+
+    ConstructionTrace::Mark ConstructionTrace::begin(std::string_view name)
+    {
+        auto& open = open_events();
+        const auto start = now();
+        const auto thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+        std::lock_guard lock(m_Mutex);
+
+        auto parent = no_parent;
+
+        if (!open.empty() && open.back().trace == this && open.back().generation == m_Generation)
+        {
+            parent = open.back().event;
+        }
+
+        const Mark mark{m_Events.size(), m_Generation};
+        m_Events.push_back({name, parent, start, start, thread});
+        open.push_back({this, mark.generation, mark.event});
+
+        return mark;
+    }
+
+    void ConstructionTrace::end(const Mark& mark)
+    {
+        const auto finish = now();
+        auto& open = open_events();
+
+        if (!open.empty() && open.back().trace == this && open.back().generation == mark.generation && open.back().event == mark.event)
+        {
+            open.pop_back();
+        }
+
+        std::lock_guard lock(m_Mutex);
+
+        // trace might have been restarted while construction was in progress, its index may belong to another event now
+        if (mark.generation == m_Generation)
+        {
+            m_Events[mark.event].end = finish;
+        }
+    }
+
+    std::chrono::nanoseconds ConstructionTrace::now() const noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start);
+    }
+
+    namespace detail
+    {
+        ConstructionTrace* active_trace() noexcept
+        {
+            return active.load(std::memory_order_acquire);
+        }
+    } // namespace detail
+} // namespace injector
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <injector/injector.hpp>
+
+using ::testing::SizeIs;
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class OtherDerived : public Base
+{
+public:
+    int foo() override
+    {
+        return 30;
+    }
+};
+
+class Consumer
+{
+public:
+    explicit Consumer(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+TEST(ChildInjector, MissingRegistrationsFallBackToParent) {
+    injector::Injector parent;
+    parent.add_singleton<Base, Derived>();
+
+    auto child = parent.create_child();
+
+    EXPECT_EQ(child.get<Base>(), parent.get<Base>());
+    EXPECT_TRUE(child.contains<Base>());
+}
+
+TEST(ChildInjector, OverridesAreVisibleOnlyInChild) {
+    injector::Injector parent;
+    parent.add<Base, Derived>();
+    parent.add<Consumer>();
+
+    auto child = parent.create_child();
+    child.add<Base, OtherDerived>();
+
+    EXPECT_EQ(child.get<Consumer>()->base->foo(), 30);
+    EXPECT_EQ(parent.get<Consumer>()->base->foo(), 20);
+    EXPECT_EQ(child.get<Consumer>()->base->foo(), 30);
+    EXPECT_THAT(child.get<std::vector<Base>>(), SizeIs(1));
+}
+
+TEST(ChildInjector, ParentRegistrationsAddedLaterAreVisible) {
+    injector::Injector parent;
+    parent.add<Consumer>();
+
+    auto child = parent.create_child();
+
+    ASSERT_THROW(child.get<Consumer>(), injector::ComponentCreationException);
+
+    parent.add<Base, Derived>();
+
+    EXPECT_EQ(child.get<Consumer>()->base->foo(), 20);
+}
+
+TEST(ChildInjector, ManyTenantsKeepTheirOwnOverrides) {
+    constexpr int tenants = 1000;
+
+    injector::Injector parent;
+    parent.add<Base, Derived>();
+    parent.add<Consumer>();
+
+    const auto generation = parent.generation();
+
+    std::vector<std::unique_ptr<injector::ChildInjector>> children;
+    children.reserve(tenants);
+
+    for (int i = 0; i < tenants; ++i)
+    {
+        auto& child = *children.emplace_back(std::make_unique<injector::ChildInjector>(parent));
+
+        if (i % 2 == 0)
+        {
+            child.add<Base, OtherDerived>();
+        }
+    }
+
+    // registrations of children never invalidate plans of the parent
+    EXPECT_EQ(parent.generation(), generation);
+
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int i = 0; i < tenants; ++i)
+        {
+            ASSERT_EQ(children[i]->get<Consumer>()->base->foo(), i % 2 == 0 ? 30 : 20);
+        }
+
+        EXPECT_EQ(parent.get<Consumer>()->base->foo(), 20);
+    }
+}
+
+TEST(ChildInjector, ChildOfFrozenInjector) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    auto frozen = injector.freeze();
+
+    auto child = frozen.create_child();
+    child.add<Consumer>();
+
+    EXPECT_EQ(child.get<Consumer>()->base, frozen.get<Base>());
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <injector/injector.hpp>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+
+using ::testing::SizeIs;
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+template<std::size_t Index>
+class Plugin
+{
+};
+
+template<std::size_t... Indices>
+void add_plugins(injector::ConcurrentInjector& injector, std::index_sequence<Indices...> /*indices*/)
+{
+    (injector.add<Plugin<Indices>>(), ...);
+}
+
+TEST(ConcurrentInjector, ResolvesLikeRegularInjector) {
+    injector::ConcurrentInjector injector;
+    injector.add_singleton<Base, Derived>();
+
+    auto res1 = injector.get<Base>();
+    auto res2 = injector.get<Base>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_EQ(res1, res2);
+    EXPECT_TRUE(injector.contains<Base>());
+}
+
+TEST(ConcurrentInjector, RegistrationsAreVisibleToConcurrentReaders) {
+    constexpr std::size_t registration_count = 64;
+
+    injector::ConcurrentInjector injector;
+    std::atomic<bool> done = false;
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&] {
+            std::size_t last_size = 0;
+
+            while (!done.load())
+            {
+                auto instances = injector.get<std::vector<Base>>();
+
+                EXPECT_GE(instances.size(), last_size);
+                last_size = instances.size();
+            }
+        });
+    }
+
+    for (std::size_t i = 0; i < registration_count; ++i)
+    {
+        injector.add<Base, Derived>();
+    }
+
+    done.store(true);
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_THAT(injector.get<std::vector<Base>>(), SizeIs(registration_count));
+}
+
+TEST(ConcurrentInjector, RegistrationsSurviveTableGrowth) {
+    injector::ConcurrentInjector injector;
+    injector.add_singleton<Base, Derived>();
+
+    auto expected = injector.get<Base>();
+    std::atomic<bool> done = false;
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&] {
+            while (!done.load())
+            {
+                EXPECT_EQ(injector.get<Base>(), expected);
+            }
+        });
+    }
+
+    add_plugins(injector, std::make_index_sequence<128>());
+    done.store(true);
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_TRUE(injector.contains<Plugin<0>>());
+    EXPECT_TRUE(injector.contains<Plugin<127>>());
+    EXPECT_EQ(injector.get<Base>(), expected);
+}
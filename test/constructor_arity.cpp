@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Pair
+{
+public:
+    Pair(std::shared_ptr<Base> first, std::shared_ptr<Base> second)
+        : first(std::move(first)),
+          second(std::move(second))
+    {
+    }
+
+    std::shared_ptr<Base> first;
+    std::shared_ptr<Base> second;
+};
+
+class Overloaded
+{
+public:
+    explicit Overloaded(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    Overloaded(std::shared_ptr<Base> base, std::shared_ptr<Pair> pair)
+        : base(std::move(base)),
+          pair(std::move(pair))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+    std::shared_ptr<Pair> pair;
+};
+
+class Gapped
+{
+public:
+    explicit Gapped(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    Gapped(std::shared_ptr<Base> base, std::shared_ptr<Pair> pair, std::shared_ptr<Overloaded> overloaded)
+        : base(std::move(base)),
+          pair(std::move(pair)),
+          overloaded(std::move(overloaded))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+    std::shared_ptr<Pair> pair;
+    std::shared_ptr<Overloaded> overloaded;
+};
+
+class Incomplete
+{
+public:
+    explicit Incomplete(int& value);
+};
+
+// arity is a constant that other components can reuse
+static_assert(injector::detail::constructor_arity_v<Derived> == 0);
+static_assert(injector::detail::constructor_arity_v<Pair> == 2);
+static_assert(injector::detail::constructor_arity_v<Overloaded> == 2);
+static_assert(injector::detail::constructor_arity_v<Gapped> == 3);
+static_assert(injector::detail::constructor_arity_v<Incomplete> == 0);
+
+TEST(ConstructorArity, WidestSatisfiableConstructorIsUsed) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+    injector.add<Pair>();
+    injector.add<Overloaded>();
+
+    auto res = injector.get<std::shared_ptr<Overloaded>>();
+
+    EXPECT_EQ(res->base->foo(), 20);
+    ASSERT_NE(res->pair, nullptr);
+    EXPECT_EQ(res->pair->first->foo(), 20);
+}
+
+TEST(ConstructorArity, WidestConstructorIsFoundPastMissingArity) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+
+    auto res = injector.get<Gapped>();
+
+    EXPECT_NE(res->pair, nullptr);
+    EXPECT_NE(res->overloaded, nullptr);
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+#include <injector/coroutine.hpp>
+
+#include <stdexcept>
+
+class Database
+{
+public:
+    int port = 0;
+};
+
+class Secrets
+{
+};
+
+// Suspends awaiters until opened by the test
+class Gate
+{
+public:
+    auto wait() noexcept
+    {
+        struct Awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> awaiter)
+            {
+                gate->m_Awaiters.push_back(awaiter);
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+
+            Gate* gate;
+        };
+
+        return Awaiter{this};
+    }
+
+    void open()
+    {
+        auto awaiters = std::move(m_Awaiters);
+
+        for (auto awaiter : awaiters)
+        {
+            awaiter.resume();
+        }
+    }
+
+private:
+    std::vector<std::coroutine_handle<>> m_Awaiters;
+};
+
+// Eagerly started coroutine whose frame is destroyed once it finishes
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+
+template<class T>
+Detached resolve_into(injector::InjectorBase& injector, std::shared_ptr<T>& result, bool& failed)
+{
+    try
+    {
+        result = co_await injector::resolve<T>(injector);
+    }
+    catch (const std::exception&)
+    {
+        failed = true;
+    }
+}
+
+TEST(Coroutine, ConcurrentAwaitersShareConstruction) {
+    Gate gate;
+    int invocations = 0;
+
+    injector::Injector injector;
+    injector::add_async_singleton<Database>(injector, [&]() -> injector::Task<std::shared_ptr<Database>> {
+        invocations += 1;
+        co_await gate.wait();
+
+        auto database = std::make_shared<Database>();
+        database->port = 5432;
+        co_return database;
+    });
+
+    std::shared_ptr<Database> first;
+    std::shared_ptr<Database> second;
+    bool failed = false;
+
+    resolve_into(injector, first, failed);
+    resolve_into(injector, second, failed);
+
+    EXPECT_EQ(first, nullptr);
+    EXPECT_EQ(invocations, 1);
+
+    gate.open();
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->port, 5432);
+    EXPECT_FALSE(failed);
+
+    std::shared_ptr<Database> third;
+    resolve_into(injector, third, failed);
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(invocations, 1);
+}
+
+TEST(Coroutine, SynchronousBindingIsReadyImmediately) {
+    injector::Injector injector;
+    injector.add_singleton<Secrets>();
+
+    std::shared_ptr<Secrets> secrets;
+    bool failed = false;
+    resolve_into(injector, secrets, failed);
+
+    EXPECT_EQ(secrets, injector.get<Secrets>());
+}
+
+TEST(Coroutine, FailureIsReportedAndRetried) {
+    Gate gate;
+    bool fail = true;
+
+    injector::Injector injector;
+    injector::add_async_singleton<Database>(injector, [&](injector::InjectorBase& /*injector*/) -> injector::Task<std::shared_ptr<Database>> {
+        co_await gate.wait();
+
+        if (fail)
+        {
+            throw std::runtime_error("connection refused");
+        }
+
+        co_return std::make_shared<Database>();
+    });
+
+    std::shared_ptr<Database> database;
+    bool failed = false;
+
+    resolve_into(injector, database, failed);
+    gate.open();
+    EXPECT_TRUE(failed);
+    EXPECT_EQ(database, nullptr);
+
+    fail = false;
+    failed = false;
+    resolve_into(injector, database, failed);
+    gate.open();
+    EXPECT_FALSE(failed);
+    EXPECT_NE(database, nullptr);
+}
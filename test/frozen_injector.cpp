@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <injector/injector.hpp>
+
+#include <memory>
+#include <utility>
+
+using ::testing::SizeIs;
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class OtherDerived : public Base
+{
+public:
+    int foo() override
+    {
+        return 30;
+    }
+};
+
+class Consumer
+{
+public:
+    explicit Consumer(std::shared_ptr<Base> base)
+        : m_Base(std::move(base))
+    {
+    }
+
+    [[nodiscard]] const std::shared_ptr<Base>& base() const
+    {
+        return m_Base;
+    }
+
+private:
+    std::shared_ptr<Base> m_Base;
+};
+
+template<std::size_t Index>
+class Plugin
+{
+};
+
+template<std::size_t... Indices>
+void register_plugins(injector::Injector& injector, std::index_sequence<Indices...> /*indices*/)
+{
+    (injector.add_singleton<Plugin<Indices>>(), ...);
+}
+
+template<std::size_t... Indices>
+bool contains_plugins(const injector::FrozenInjector& injector, std::index_sequence<Indices...> /*indices*/)
+{
+    return (injector.contains<Plugin<Indices>>() && ...);
+}
+
+TEST(FrozenInjector, ResolvesSingletonRegisteredBeforeFreezing) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    auto frozen = injector.freeze();
+
+    auto res1 = frozen.get<Base>();
+    auto res2 = frozen.get<Base>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_EQ(res1, res2);
+    EXPECT_FALSE(injector.contains<Base>());
+}
+
+TEST(FrozenInjector, ResolvesConstructorDependencies) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Consumer>();
+
+    auto frozen = injector.freeze();
+
+    auto consumer = frozen.get<Consumer>();
+
+    EXPECT_EQ(consumer->base(), frozen.get<Base>());
+}
+
+TEST(FrozenInjector, LastRegistrationWinsAndAllAreEnumerated) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+    injector.add<Base, OtherDerived>();
+
+    auto frozen = injector.freeze();
+
+    EXPECT_EQ(frozen.get<Base>()->foo(), 30);
+    ASSERT_THAT(frozen.get<std::vector<Base>>(), SizeIs(2));
+}
+
+TEST(FrozenInjector, MovedInjectorOwnsItsBindings) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+    injector.add_singleton<Consumer>();
+
+    auto first = std::make_unique<injector::FrozenInjector>(injector.freeze());
+    injector::FrozenInjector second(std::move(*first));
+
+    EXPECT_FALSE(first->contains<Consumer>());
+    EXPECT_THROW(first->get<Consumer>(), injector::ComponentCreationException);
+
+    first.reset();
+
+    EXPECT_EQ(second.get<Consumer>()->base()->foo(), 20);
+
+    injector::FrozenInjector third = injector::Injector().freeze();
+    third = std::move(second);
+
+    EXPECT_EQ(third.get<Consumer>(), third.get<Consumer>());
+}
+
+TEST(FrozenInjector, MissingRegistration) {
+    injector::Injector injector;
+    auto frozen = injector.freeze();
+
+    EXPECT_FALSE(frozen.contains<Base>());
+    EXPECT_THAT(frozen.get<std::vector<Base>>(), SizeIs(0));
+    ASSERT_THROW(frozen.get<Base>(), injector::ComponentCreationException);
+}
+
+TEST(FrozenInjector, ResolvesEveryRegistrationOfLargeInjector) {
+    constexpr std::size_t plugin_count = 300;
+
+    injector::Injector injector;
+    register_plugins(injector, std::make_index_sequence<plugin_count>());
+    injector.add<Base, Derived>();
+
+    auto frozen = injector.freeze();
+
+    EXPECT_TRUE(contains_plugins(frozen, std::make_index_sequence<plugin_count>()));
+    EXPECT_EQ(frozen.get<Base>()->foo(), 20);
+    EXPECT_FALSE(frozen.contains<Consumer>());
+}
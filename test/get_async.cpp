@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Both halves wait for each other, thus they can only be created when constructed concurrently
+class Rendezvous
+{
+public:
+    bool arrive()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Arrived += 1;
+        m_Condition.notify_all();
+
+        return m_Condition.wait_for(lock, std::chrono::seconds(5), [this] {
+            return m_Arrived == 2;
+        });
+    }
+
+    static Rendezvous& instance()
+    {
+        static Rendezvous rendezvous;
+        return rendezvous;
+    }
+
+private:
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    int m_Arrived = 0;
+};
+
+class LeftHalf
+{
+public:
+    LeftHalf()
+        : concurrent(Rendezvous::instance().arrive())
+    {
+    }
+
+    bool concurrent;
+};
+
+class RightHalf
+{
+public:
+    RightHalf()
+        : concurrent(Rendezvous::instance().arrive())
+    {
+    }
+
+    bool concurrent;
+};
+
+class Joined
+{
+public:
+    Joined(std::shared_ptr<LeftHalf> left, std::shared_ptr<RightHalf> right)
+        : left(std::move(left)),
+          right(std::move(right))
+    {
+    }
+
+    std::shared_ptr<LeftHalf> left;
+    std::shared_ptr<RightHalf> right;
+};
+
+class Clock
+{
+};
+
+class Journal
+{
+};
+
+class Ledger
+{
+public:
+    Ledger(std::shared_ptr<Clock> clock, std::shared_ptr<Journal> journal)
+        : clock(std::move(clock)),
+          journal(std::move(journal))
+    {
+    }
+
+    std::shared_ptr<Clock> clock;
+    std::shared_ptr<Journal> journal;
+};
+
+class Unresolvable
+{
+public:
+    virtual ~Unresolvable() = default;
+
+    virtual void run() = 0;
+};
+
+class NeedsUnresolvable
+{
+public:
+    explicit NeedsUnresolvable(std::shared_ptr<Unresolvable> dependency)
+        : dependency(std::move(dependency))
+    {
+    }
+
+    std::shared_ptr<Unresolvable> dependency;
+};
+
+// Runs tasks on calling thread only when asked to
+class QueueExecutor
+{
+public:
+    void operator()(std::function<void()> task)
+    {
+        tasks.push_back(std::move(task));
+    }
+
+    void drain()
+    {
+        while (!tasks.empty())
+        {
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            task();
+        }
+    }
+
+    std::deque<std::function<void()>> tasks;
+};
+
+TEST(GetAsync, CreatesIndependentDependenciesConcurrently) {
+    injector::Injector injector;
+    injector.add_singleton<LeftHalf>();
+    injector.add_singleton<RightHalf>();
+    injector.add<Joined>();
+
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+
+    auto future = injector.get_async<Joined>([&](std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.emplace_back(std::move(task));
+    });
+
+    auto joined = future.get();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    ASSERT_NE(joined, nullptr);
+    EXPECT_TRUE(joined->left->concurrent);
+    EXPECT_TRUE(joined->right->concurrent);
+    EXPECT_EQ(joined->left, injector.get<LeftHalf>());
+}
+
+TEST(GetAsync, SingleThreadedExecutorDoesNotDeadlock) {
+    injector::Injector injector;
+    injector.add_singleton<Clock>();
+    injector.add_singleton<Journal>();
+    injector.add<Ledger>();
+
+    QueueExecutor executor;
+    auto future = injector.get_async<std::shared_ptr<Ledger>>(std::ref(executor));
+
+    ASSERT_EQ(executor.tasks.size(), 1);
+    auto root = std::move(executor.tasks.front());
+    executor.tasks.pop_front();
+    root();
+
+    // siblings have been scheduled, but the waiting task has already run them itself
+    EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_NE(future.get(), nullptr);
+
+    executor.drain();
+}
+
+#if INJECTOR_HAS_EXCEPTIONS
+TEST(GetAsync, FailureIsStoredInFuture) {
+    injector::Injector injector;
+    injector.add<NeedsUnresolvable>();
+
+    QueueExecutor executor;
+    auto future = injector.get_async<NeedsUnresolvable>(std::ref(executor));
+    executor.drain();
+
+    EXPECT_THROW(future.get(), injector::ComponentCreationException);
+}
+#endif
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Consumer
+{
+public:
+    explicit Consumer(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+template<class T>
+class CountingAllocator
+{
+public:
+    using value_type = T;
+
+    explicit CountingAllocator(int* allocations)
+        : m_Allocations(allocations)
+    {
+    }
+
+    template<class U>
+    CountingAllocator(const CountingAllocator<U>& other) // NOLINT implicit conversion
+        : m_Allocations(other.allocations())
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        *m_Allocations += 1;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, std::size_t count)
+    {
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    [[nodiscard]] int* allocations() const
+    {
+        return m_Allocations;
+    }
+
+    template<class U>
+    bool operator==(const CountingAllocator<U>& other) const
+    {
+        return m_Allocations == other.allocations();
+    }
+
+    template<class U>
+    bool operator!=(const CountingAllocator<U>& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    int* m_Allocations;
+};
+
+TEST(InjectorWithAllocator, TransientObjectsAreAllocatedWithGivenAllocator) {
+    int allocations = 0;
+
+    injector::Injector injector;
+    injector.add<Base, Derived>(injector::with_allocator(CountingAllocator<Derived>(&allocations)));
+
+    auto res1 = injector.get<Base>();
+    auto res2 = injector.get<Base>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_NE(res1, res2);
+    EXPECT_EQ(allocations, 2);
+}
+
+TEST(InjectorWithAllocator, SingletonIsAllocatedOnce) {
+    int allocations = 0;
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>(injector::with_allocator(CountingAllocator<Derived>(&allocations)));
+
+    auto res1 = injector.get<Base>();
+    auto res2 = injector.get<Base>();
+
+    EXPECT_EQ(res1, res2);
+    EXPECT_EQ(allocations, 1);
+}
+
+TEST(InjectorWithAllocator, ConstructorArgumentsAreResolved) {
+    int allocations = 0;
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Consumer>(injector::with_allocator(CountingAllocator<Consumer>(&allocations)));
+
+    auto consumer = injector.get<Consumer>();
+
+    EXPECT_EQ(consumer->base, injector.get<Base>());
+    EXPECT_EQ(allocations, 1);
+}
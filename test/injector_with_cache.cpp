@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class LookupTable : public Base
+{
+public:
+    LookupTable()
+    {
+        s_Instances += 1;
+    }
+
+    int foo() override
+    {
+        return 20;
+    }
+
+    static inline int s_Instances = 0;
+};
+
+class Model
+{
+public:
+    Model()
+    {
+        s_Instances += 1;
+    }
+
+    static inline int s_Instances = 0;
+};
+
+using namespace std::chrono_literals;
+
+TEST(InjectorWithCache, ReusesRecentlyUsedObject) {
+    LookupTable::s_Instances = 0;
+
+    injector::Injector injector;
+    injector.add_cached<Base, LookupTable>(1h);
+
+    auto first = injector.get<Base>().get();
+    auto second = injector.get<Base>().get();
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(LookupTable::s_Instances, 1);
+    EXPECT_EQ(injector.get<Base>()->foo(), 20);
+}
+
+TEST(InjectorWithCache, ReleasesIdleObject) {
+    LookupTable::s_Instances = 0;
+
+    injector::Injector injector;
+    injector.add_cached<Base, LookupTable>(1ms);
+
+    auto in_use = injector.get<Base>();
+    std::this_thread::sleep_for(5ms);
+    injector::trim_cache();
+
+    // object referenced elsewhere stays alive and is handed out again
+    EXPECT_EQ(injector.get<Base>(), in_use);
+
+    in_use.reset();
+    std::this_thread::sleep_for(5ms);
+    injector::trim_cache();
+
+    injector.get<Base>();
+    EXPECT_EQ(LookupTable::s_Instances, 2);
+}
+
+TEST(InjectorWithCache, BudgetReleasesLeastRecentlyUsed) {
+    LookupTable::s_Instances = 0;
+    Model::s_Instances = 0;
+
+    injector::Injector injector;
+    injector.add_cached<Base, LookupTable>(1h, 100);
+    injector.add_cached<Model>(1h, 100);
+
+    injector::set_cache_budget(150);
+
+    injector.get<Base>();
+    injector.get<Model>();
+    injector.get<Model>();
+    injector.get<Base>();
+
+    injector::set_cache_budget(std::numeric_limits<std::size_t>::max());
+
+    EXPECT_EQ(Model::s_Instances, 1);
+    EXPECT_EQ(LookupTable::s_Instances, 2);
+}
+
+TEST(InjectorWithCache, ConcurrentReuseHandsOutSameObject) {
+    injector::Injector injector;
+    injector.add_cached<Model>(1h);
+
+    const auto expected = injector.get<Model>();
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < 1000; ++j)
+            {
+                EXPECT_EQ(injector.get<Model>(), expected);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
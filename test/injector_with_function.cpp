@@ -3,6 +3,11 @@
 
 #include <injector/injector.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 using ::testing::SizeIs;
 
 class Base
@@ -66,6 +71,41 @@ TEST(InjectorWithFunction, CreatingDerivedObjectWithSingletonFunctionFactory) {
     EXPECT_EQ(call_count, 1);
 }
 
+TEST(InjectorWithFunction, ConcurrentSingletonFunctionFactoryIsInvokedOnce) {
+    std::atomic<int> call_count = 0;
+
+    auto factory = [&] {
+        call_count += 1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::make_shared<Derived>();
+    };
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>(factory);
+
+    std::vector<std::shared_ptr<Base>> results(8);
+    std::vector<std::thread> threads;
+
+    for (auto& result : results)
+    {
+        threads.emplace_back([&] {
+            result = injector.get<Base>();
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& result : results)
+    {
+        EXPECT_EQ(result, results.front());
+    }
+
+    EXPECT_EQ(call_count, 1);
+}
+
 TEST(InjectorWithFunction, ObjectCreationThatReturnsNull) {
     auto factory = [] {
         return nullptr;
@@ -89,4 +129,44 @@ TEST(InjectorWithFunction, TryAddingExistingFactoryFunction) {
     auto registrations = injector.get<std::vector<std::shared_ptr<Base>>>();
 
     ASSERT_THAT(registrations, SizeIs(1));
-}
\ No newline at end of file
+}
+TEST(InjectorWithFunction, FunctionParametersAreInjected) {
+    class Wrapper : public Base
+    {
+    public:
+        explicit Wrapper(std::shared_ptr<Base> inner)
+            : m_Inner(std::move(inner))
+        {
+        }
+
+        int foo() override
+        {
+            return m_Inner->foo() + 1;
+        }
+
+    private:
+        std::shared_ptr<Base> m_Inner;
+    };
+
+    injector::Injector injector;
+    injector.add_singleton<Derived>();
+    injector.add<Wrapper>([](std::shared_ptr<Derived> inner, injector::Lazy<Derived> lazy) {
+        EXPECT_EQ(inner, lazy.get());
+        return std::make_shared<Wrapper>(std::move(inner));
+    });
+
+    EXPECT_EQ(injector.get<Wrapper>()->foo(), 21);
+}
+
+TEST(InjectorWithFunction, LargeCallableIsAccepted) {
+    std::array<int, 64> values{};
+    values.back() = 20;
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>([values] {
+        EXPECT_EQ(values.back(), 20);
+        return std::make_shared<Derived>();
+    });
+
+    EXPECT_EQ(injector.get<Base>()->foo(), 20);
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <atomic>
+#include <thread>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Buffer
+{
+public:
+    Buffer()
+    {
+        ++created;
+    }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    ~Buffer()
+    {
+        ++destroyed;
+    }
+
+    static inline int created = 0;
+    static inline int destroyed = 0;
+
+    int used = 0;
+};
+
+class Scratch
+{
+public:
+    int used = 0;
+};
+
+class BufferHolder
+{
+public:
+    explicit BufferHolder(std::shared_ptr<Buffer> buffer)
+        : buffer(std::move(buffer))
+    {
+    }
+
+    std::shared_ptr<Buffer> buffer;
+};
+
+TEST(InjectorWithPool, ReleasedObjectIsReused) {
+    injector::Injector injector;
+    injector.add_pooled<Base, Derived>(4);
+
+    Base* released = nullptr;
+
+    {
+        auto res = injector.get<Base>();
+        released = res.get();
+        EXPECT_EQ(res->foo(), 20);
+    }
+
+    auto res1 = injector.get<Base>();
+    auto res2 = injector.get<Base>();
+
+    EXPECT_EQ(res1.get(), released);
+    EXPECT_NE(res2.get(), released);
+}
+
+TEST(InjectorWithPool, ResetIsInvokedOnRelease) {
+    Buffer::created = 0;
+
+    injector::Injector injector;
+    injector.add_pooled<Buffer>(1, [](Buffer& buffer) {
+        buffer.used = 0;
+    });
+
+    injector.get<Buffer>()->used = 10;
+
+    auto res = injector.get<Buffer>();
+
+    EXPECT_EQ(res->used, 0);
+    EXPECT_EQ(Buffer::created, 1);
+}
+
+TEST(InjectorWithPool, ObjectsReleasedOnOtherThreadAreReused) {
+    Buffer::created = 0;
+
+    injector::Injector injector;
+    injector.add_pooled<Buffer>(2);
+
+    auto res1 = injector.get<Buffer>();
+    auto res2 = injector.get<Buffer>();
+
+    std::thread thread([res = std::move(res1)]() mutable {
+        res.reset();
+    });
+    thread.join();
+    res2.reset();
+
+    injector.get<Buffer>();
+    injector.get<Buffer>();
+
+    EXPECT_EQ(Buffer::created, 2);
+}
+
+TEST(InjectorWithPool, ThreadCacheCountsAgainstCapacity) {
+    Buffer::created = 0;
+    Buffer::destroyed = 0;
+
+    injector::Injector injector;
+    injector.add_pooled<Buffer>(1);
+
+    auto res1 = injector.get<Buffer>();
+    auto res2 = injector.get<Buffer>();
+
+    res1.reset();
+    res2.reset();
+
+    EXPECT_EQ(Buffer::destroyed, 1);
+
+    injector.get<Buffer>();
+
+    EXPECT_EQ(Buffer::created, 2);
+}
+
+TEST(InjectorWithPool, ConcurrentReuseKeepsObjectsDistinct) {
+    constexpr int iterations = 10000;
+
+    injector::Injector injector;
+    injector.add_pooled<Scratch>(2);
+
+    std::atomic<int> shared = 0;
+
+    auto use = [&injector, &shared]() {
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto scratch = injector.get<Scratch>();
+
+            if (scratch->used++ != 0)
+            {
+                shared.fetch_add(1);
+            }
+
+            scratch->used = 0;
+        }
+    };
+
+    std::thread first(use);
+    std::thread second(use);
+
+    first.join();
+    second.join();
+
+    EXPECT_EQ(shared.load(), 0);
+}
+
+TEST(InjectorWithPool, ObjectReleasedWhileThreadExitsIsReused) {
+    Buffer::created = 0;
+
+    injector::Injector injector;
+    injector.add_pooled<Buffer>(4);
+    injector.add_thread_local<BufferHolder>();
+
+    Buffer* released = nullptr;
+
+    // holder is destroyed together with thread local objects of the thread, after its pool cache is gone
+    std::thread([&]() {
+        released = injector.get<BufferHolder>()->buffer.get();
+    }).join();
+
+    auto buffer = injector.get<Buffer>();
+
+    EXPECT_EQ(buffer.get(), released);
+    EXPECT_EQ(Buffer::created, 1);
+}
+
+TEST(InjectorWithPool, ObjectMayOutliveInjector) {
+    std::shared_ptr<Base> res;
+
+    {
+        injector::Injector injector;
+        injector.add_pooled<Base, Derived>(1);
+        res = injector.get<Base>();
+    }
+
+    EXPECT_EQ(res->foo(), 20);
+}
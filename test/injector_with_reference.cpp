@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+TEST(InjectorWithReference, BorrowingSingletonDoesNotShareOwnership) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    auto& ref1 = injector.get_ref<Base>();
+    auto& ref2 = injector.get_ref<Base>();
+    auto instance = injector.get<Base>();
+
+    EXPECT_EQ(ref1.foo(), 20);
+    EXPECT_EQ(&ref1, &ref2);
+    EXPECT_EQ(&ref1, instance.get());
+    EXPECT_EQ(instance.use_count(), 2);
+}
+
+TEST(InjectorWithReference, BorrowingSingletonAfterRetrieval) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    auto first = injector.get<Base>();
+    auto second = injector.get<Base>();
+
+    EXPECT_EQ(&injector.get_ref<Base>(), first.get());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first.use_count(), 3);
+}
+
+TEST(InjectorWithReference, BorrowingConstant) {
+    auto value = std::make_shared<Derived>();
+
+    injector::Injector injector;
+    injector.add<Base, Derived>(value);
+
+    EXPECT_EQ(&injector.get_ref<Base>(), value.get());
+    EXPECT_EQ(value.use_count(), 2);
+}
+
+TEST(InjectorWithReference, BorrowingScopedWithinScope) {
+    injector::Injector injector;
+    injector.add_scoped<Base, Derived>();
+
+    auto scope = injector.create_scope();
+
+    EXPECT_EQ(&scope.get_ref<Base>(), scope.get<Base>().get());
+}
+
+TEST(InjectorWithReference, BorrowingTransientIsNotAllowed) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+
+    ASSERT_THROW(injector.get_ref<Base>(), injector::ComponentCreationException);
+}
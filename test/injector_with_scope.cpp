@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <type_traits>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Consumer
+{
+public:
+    explicit Consumer(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+// objects created in scope refer to it, moving it would leave them dangling
+static_assert(!std::is_move_constructible_v<injector::Scope>);
+static_assert(!std::is_move_assignable_v<injector::Scope>);
+
+TEST(InjectorWithScope, ScopedObjectIsSharedWithinScope) {
+    injector::Injector injector;
+    injector.add_scoped<Base, Derived>();
+
+    auto scope1 = injector.create_scope();
+    auto scope2 = injector.create_scope();
+
+    auto res1 = scope1.get<Base>();
+    auto res2 = scope1.get<Base>();
+    auto res3 = scope2.get<Base>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_EQ(res1, res2);
+    EXPECT_NE(res1, res3);
+}
+
+TEST(InjectorWithScope, DependenciesResolveWithinScope) {
+    injector::Injector injector;
+    injector.add_scoped<Base, Derived>();
+    injector.add<Consumer>();
+
+    auto scope = injector.create_scope();
+
+    auto consumer1 = scope.get<Consumer>();
+    auto consumer2 = scope.get<Consumer>();
+
+    EXPECT_NE(consumer1, consumer2);
+    EXPECT_EQ(consumer1->base, consumer2->base);
+    EXPECT_EQ(consumer1->base, scope.get<Base>());
+}
+
+TEST(InjectorWithScope, ScopedObjectIsReleasedWithScope) {
+    injector::Injector injector;
+    injector.add_scoped<Base, Derived>();
+
+    std::weak_ptr<Base> instance;
+
+    {
+        auto scope = injector.create_scope();
+        instance = scope.get<Base>();
+
+        EXPECT_FALSE(instance.expired());
+    }
+
+    EXPECT_TRUE(instance.expired());
+}
+
+TEST(InjectorWithScope, ScopedFunctionFactoryIsInvokedOncePerScope) {
+    int call_count = 0;
+
+    auto factory = [&] {
+        call_count += 1;
+        return std::make_shared<Derived>();
+    };
+
+    injector::Injector injector;
+    injector.add_scoped<Base, Derived>(factory);
+
+    auto scope = injector.create_scope();
+    scope.get<Base>();
+    scope.get<Base>();
+
+    EXPECT_EQ(call_count, 1);
+}
+
+TEST(InjectorWithScope, ResolvingScopedOutsideOfScope) {
+    injector::Injector injector;
+    injector.add_scoped<Base, Derived>();
+
+    ASSERT_THROW(injector.get<Base>(), injector::ComponentCreationException);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <thread>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+TEST(InjectorWithThreadLocal, ObjectIsSharedWithinThread) {
+    injector::Injector injector;
+    injector.add_thread_local<Base, Derived>();
+
+    auto res1 = injector.get<Base>();
+    auto res2 = injector.get<Base>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_EQ(res1, res2);
+    EXPECT_EQ(&injector.get_ref<Base>(), res1.get());
+}
+
+TEST(InjectorWithThreadLocal, EachThreadGetsOwnObject) {
+    injector::Injector injector;
+    injector.add_thread_local<Base, Derived>();
+
+    auto main_instance = injector.get<Base>();
+    std::shared_ptr<Base> thread_instance1;
+    std::shared_ptr<Base> thread_instance2;
+
+    std::thread thread([&] {
+        thread_instance1 = injector.get<Base>();
+        thread_instance2 = injector.get<Base>();
+    });
+    thread.join();
+
+    EXPECT_EQ(thread_instance1, thread_instance2);
+    EXPECT_NE(thread_instance1, main_instance);
+}
+
+TEST(InjectorWithThreadLocal, ObjectIsReleasedWhenThreadExits) {
+    injector::Injector injector;
+    injector.add_thread_local<Base, Derived>();
+
+    std::weak_ptr<Base> instance;
+
+    std::thread thread([&] {
+        instance = injector.get<Base>();
+    });
+    thread.join();
+
+    EXPECT_TRUE(instance.expired());
+}
+
+TEST(InjectorWithThreadLocal, BindingsOfDifferentInjectorsAreIndependent) {
+    int created = 0;
+
+    auto factory = [&created]() -> std::shared_ptr<Base> {
+        ++created;
+        return std::make_shared<Derived>();
+    };
+
+    auto first = std::make_unique<injector::Injector>();
+    first->add_thread_local<Base>(factory);
+    first->get<Base>();
+    first.reset();
+
+    injector::Injector second;
+    second.add_thread_local<Base>(factory);
+
+    auto res1 = second.get<Base>();
+    auto res2 = second.get<Base>();
+
+    EXPECT_EQ(res1, res2);
+    EXPECT_EQ(created, 2);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Message
+{
+public:
+    Message(std::shared_ptr<Base> base, std::unique_ptr<Base> owned)
+        : base(std::move(base)),
+          owned(std::move(owned))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+    std::unique_ptr<Base> owned;
+};
+
+TEST(InjectorWithUnique, TransientBindingIsCreatedAsUniquePointer) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+
+    std::unique_ptr<Base> res1 = injector.get<std::unique_ptr<Base>>();
+    std::unique_ptr<Base> res2 = injector.get<std::unique_ptr<Base>>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_NE(res1, res2);
+}
+
+TEST(InjectorWithUnique, ConstructorArgumentsAreResolved) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    ASSERT_THROW(injector.get<std::unique_ptr<Message>>(), injector::ComponentCreationException);
+
+    injector::Injector transient;
+    transient.add<Base, Derived>();
+
+    auto message = transient.get<std::unique_ptr<Message>>();
+    Message value = transient.get_value<Message>();
+
+    EXPECT_EQ(message->owned->foo(), 20);
+    EXPECT_EQ(value.base->foo(), 20);
+    EXPECT_NE(value.base.get(), value.owned.get());
+}
+
+TEST(InjectorWithUnique, BindingsWithOtherLifetimesAreRejected) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add_singleton<Derived>();
+
+    try
+    {
+        injector.get<std::unique_ptr<Base>>();
+        FAIL();
+    }
+    catch (const injector::ComponentCreationException& exception)
+    {
+        EXPECT_EQ(exception.error().code, injector::ErrorCode::NotTransient);
+    }
+
+    ASSERT_THROW(injector.get_value<Derived>(), injector::ComponentCreationException);
+}
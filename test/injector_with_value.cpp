@@ -22,6 +22,15 @@ public:
     }
 };
 
+class VirtuallyDerived : public virtual Base
+{
+public:
+    int foo() override
+    {
+        return 40;
+    }
+};
+
 TEST(InjectorWithValue, AddValueAsDervivedFromBaseClassToInjector) {
     auto value = std::make_shared<Derived>();
 
@@ -56,4 +65,15 @@ TEST(InjectorWithValue, TryAddValueThatAlearyHasBeenAdded) {
     auto registrations = injector.get<std::vector<std::shared_ptr<Base>>>();
 
     ASSERT_THAT(registrations, SizeIs(1));
-}
\ No newline at end of file
+}
+
+TEST(InjectorWithValue, AddValueDerivedFromVirtualBase) {
+    auto value = std::make_shared<VirtuallyDerived>();
+
+    injector::Injector injector;
+    injector.add<Base, VirtuallyDerived>(value);
+
+    EXPECT_EQ(injector.get<Base>(), value);
+    EXPECT_EQ(&injector.get_ref<Base>(), value.get());
+    EXPECT_EQ(value.use_count(), 2);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <cstdint>
+#include <memory>
+
+using namespace injector::literals;
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class PrimaryStore : public Base
+{
+public:
+    int foo() override
+    {
+        return 1;
+    }
+};
+
+class ReplicaStore : public Base
+{
+public:
+    int foo() override
+    {
+        return 2;
+    }
+};
+
+class Endpoint
+{
+public:
+    explicit Endpoint(int port = 0)
+        : port(port)
+    {
+    }
+
+    int port;
+};
+
+TEST(KeyedBinding, ResolvesBindingRegisteredUnderKey) {
+    injector::Injector injector;
+    injector.add_singleton<Base, PrimaryStore>("primary"_key);
+    injector.add_singleton<Base, ReplicaStore>("replica"_key);
+
+    ASSERT_EQ(injector.get<Base>("primary"_key)->foo(), 1);
+    ASSERT_EQ(injector.get<std::shared_ptr<Base>>("replica"_key)->foo(), 2);
+    ASSERT_EQ(injector.get<Base>("primary"_key), injector.get<Base>("primary"_key));
+}
+
+TEST(KeyedBinding, KeepsKeyedBindingsApartFromTypeBinding) {
+    injector::Injector injector;
+    injector.add<Endpoint>([] { return std::make_shared<Endpoint>(80); });
+    injector.add<Endpoint>("admin"_key, [] { return std::make_shared<Endpoint>(8080); });
+
+    ASSERT_EQ(injector.get<Endpoint>()->port, 80);
+    ASSERT_EQ(injector.get<Endpoint>("admin"_key)->port, 8080);
+    ASSERT_TRUE(injector.contains<Endpoint>("admin"_key));
+    ASSERT_FALSE(injector.contains<Base>("admin"_key));
+}
+
+TEST(KeyedBinding, ThrowsForUnboundKey) {
+    injector::Injector injector;
+    injector.add_singleton<Endpoint>();
+    injector.add<Base, ReplicaStore>("replica"_key);
+
+    ASSERT_THROW(injector.get<Endpoint>("missing"_key), injector::ComponentCreationException);
+    ASSERT_THROW(injector.get<Base>("primary"_key), injector::ComponentCreationException);
+}
+
+TEST(KeyedBinding, HashesConstantKeyAtCompileTime) {
+    static constexpr auto key = "replica"_key;
+    static_assert(key.hash() == injector::Key("replica").hash());
+    static_assert(injector::keyed_type_id<Base>(key) != injector::keyed_type_id<Endpoint>(key));
+    static_assert(injector::keyed_type_id<Base>(key) != injector::type_id<Base>());
+
+    injector::Injector injector;
+    injector.add<Base, ReplicaStore>(key, std::make_shared<ReplicaStore>());
+
+    ASSERT_EQ(injector.get<Base>(key)->foo(), 2);
+}
+
+TEST(KeyedBinding, TemplateKeyIsHashedAtCompileTime) {
+    constexpr std::size_t id = injector::keyed_type_id<Base>(injector::key<"replica"_hash>);
+    static_assert(injector::key<"replica"_hash>.hash() == injector::Key("replica").hash());
+    static_assert(id == injector::keyed_type_id<Base>("replica"_key));
+
+    injector::Injector injector;
+    injector.add_singleton<Base, ReplicaStore>(injector::key<"replica"_hash>);
+
+    ASSERT_EQ(injector.get<Base>("replica"_key)->foo(), 2);
+    ASSERT_EQ(injector.get<Base>(injector::key<"replica"_hash>), injector.get<Base>("replica"_key));
+}
+
+// Key whose identifier for Base equals plain identifier of Endpoint, mixing of keyed_type_id solved for the hash
+constexpr injector::Key colliding_key() noexcept
+{
+    constexpr auto base = static_cast<std::uint64_t>(injector::type_id<Base>());
+    constexpr auto endpoint = static_cast<std::uint64_t>(injector::type_id<Endpoint>());
+
+    return injector::Key::from_hash((base ^ endpoint) - 0x9e3779b97f4a7c15ULL - (base << 6) - (base >> 2));
+}
+
+TEST(KeyedBinding, CollisionWithTypeBindingIsReported) {
+    static_assert(injector::keyed_type_id<Base>(colliding_key()) == injector::type_id<Endpoint>());
+
+    injector::Injector injector;
+    injector.add<Endpoint>();
+
+    try
+    {
+        injector.add<Base, PrimaryStore>(colliding_key());
+        FAIL();
+    }
+    catch (const injector::ComponentCreationException& exception)
+    {
+        EXPECT_EQ(exception.error().code, injector::ErrorCode::KeyCollision);
+        EXPECT_EQ(exception.error().type, injector::type_id<Base>());
+    }
+
+    injector::Injector keyed;
+    keyed.add<Base, PrimaryStore>(colliding_key());
+
+    ASSERT_THROW(keyed.add<Endpoint>(), injector::ComponentCreationException);
+    ASSERT_EQ(keyed.get<Base>(colliding_key())->foo(), 1);
+
+    auto child = keyed.create_child();
+
+    ASSERT_THROW(child.add<Endpoint>(), injector::ComponentCreationException);
+}
+
+TEST(KeyedBinding, CollisionInsideInstalledModuleIsReported) {
+    injector::Module module;
+    module.add<Endpoint>();
+    module.add<Base, ReplicaStore>(colliding_key());
+
+    injector::Injector injector;
+
+    ASSERT_THROW(injector.install(std::move(module)), injector::ComponentCreationException);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class OtherDerived : public Base
+{
+public:
+    int foo() override
+    {
+        return 30;
+    }
+};
+
+class CountedDerived : public Derived
+{
+public:
+    CountedDerived()
+    {
+        ++created;
+    }
+
+    static inline int created = 0;
+};
+
+class LazyConsumer
+{
+public:
+    explicit LazyConsumer(injector::Lazy<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    injector::Lazy<Base> base;
+};
+
+class ProviderConsumer
+{
+public:
+    explicit ProviderConsumer(injector::Provider<Base> provider)
+        : provider(provider)
+    {
+    }
+
+    injector::Provider<Base> provider;
+};
+
+TEST(Lazy, DependencyIsResolvedOnFirstAccess) {
+    CountedDerived::created = 0;
+
+    injector::Injector injector;
+    injector.add<Base, CountedDerived>();
+    injector.add<LazyConsumer>();
+
+    auto consumer = injector.get<LazyConsumer>();
+
+    EXPECT_FALSE(consumer->base.resolved());
+    EXPECT_EQ(CountedDerived::created, 0);
+
+    EXPECT_EQ(consumer->base->foo(), 20);
+    EXPECT_EQ(consumer->base.get(), consumer->base.get());
+    EXPECT_EQ(CountedDerived::created, 1);
+}
+
+TEST(Lazy, FailedResolutionIsRetried) {
+    injector::Injector injector;
+    injector.add<LazyConsumer>();
+
+    auto consumer = injector.get<LazyConsumer>();
+
+    ASSERT_THROW(consumer->base.get(), injector::ComponentCreationException);
+
+    injector.add<Base, Derived>();
+
+    EXPECT_EQ((*consumer->base).foo(), 20);
+}
+
+TEST(Provider, EachCallResolvesThroughBinding) {
+    CountedDerived::created = 0;
+
+    injector::Injector injector;
+    injector.add<Base, CountedDerived>();
+    injector.add<ProviderConsumer>();
+
+    auto consumer = injector.get<ProviderConsumer>();
+
+    EXPECT_EQ(CountedDerived::created, 0);
+    EXPECT_NE(consumer->provider(), consumer->provider.get());
+    EXPECT_EQ(CountedDerived::created, 2);
+}
+
+TEST(Lazy, SingletonFirstCreatedInScopeResolvesThroughOwningInjector) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+    injector.add_singleton<LazyConsumer>();
+
+    {
+        auto scope = injector.create_scope();
+        EXPECT_FALSE(scope.get<LazyConsumer>()->base.resolved());
+    }
+
+    EXPECT_EQ(injector.get<LazyConsumer>()->base->foo(), 20);
+}
+
+TEST(Provider, ParentSingletonFirstCreatedByChildResolvesThroughParent) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+    injector.add_singleton<ProviderConsumer>();
+
+    {
+        auto child = injector.create_child();
+        child.add<Base, OtherDerived>();
+
+        EXPECT_EQ(child.get<ProviderConsumer>()->provider()->foo(), 20);
+    }
+
+    EXPECT_EQ(injector.get<ProviderConsumer>()->provider()->foo(), 20);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Consumer
+{
+public:
+    explicit Consumer(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+class CountingObserver : public injector::ResolutionObserver
+{
+public:
+    void on_resolve(const injector::BindingInfo& /*binding*/) override
+    {
+        resolutions += 1;
+    }
+
+    void on_construct(const injector::BindingInfo& /*binding*/, std::chrono::nanoseconds /*duration*/) override
+    {
+        constructions += 1;
+    }
+
+    std::atomic<int> resolutions = 0;
+    std::atomic<int> constructions = 0;
+};
+
+static const injector::BindingMetrics& find_metrics(const std::vector<injector::BindingMetrics>& metrics, std::size_t type)
+{
+    return *std::find_if(metrics.begin(), metrics.end(), [type](const injector::BindingMetrics& entry) {
+        return entry.binding.type == type;
+    });
+}
+
+TEST(Metrics, CountsResolutionsAndConstructions) {
+    if (!INJECTOR_ENABLE_METRICS)
+    {
+        GTEST_SKIP() << "Library built without INJECTOR_ENABLE_METRICS";
+    }
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Consumer>();
+
+    injector.get<std::shared_ptr<Consumer>>();
+    injector.get<std::shared_ptr<Consumer>>();
+    injector.get<std::shared_ptr<Base>>();
+
+    auto metrics = injector.metrics();
+    ASSERT_EQ(metrics.size(), 2);
+
+    const auto& base = find_metrics(metrics, injector::type_id<Base>());
+    EXPECT_EQ(base.binding.type_name, "Base");
+    EXPECT_EQ(base.binding.implementation_name, "Derived");
+    EXPECT_EQ(base.resolutions, 3);
+    EXPECT_EQ(base.constructions, 1);
+    EXPECT_EQ(base.allocated_bytes, sizeof(Derived));
+
+    const auto& consumer = find_metrics(metrics, injector::type_id<Consumer>());
+    EXPECT_EQ(consumer.resolutions, 2);
+    EXPECT_EQ(consumer.constructions, 2);
+    EXPECT_GE(consumer.total_construction_time, consumer.max_construction_time);
+}
+
+TEST(Metrics, ObserverReceivesEvents) {
+    if (!INJECTOR_ENABLE_METRICS)
+    {
+        GTEST_SKIP() << "Library built without INJECTOR_ENABLE_METRICS";
+    }
+
+    CountingObserver observer;
+    injector::set_resolution_observer(&observer);
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.get<std::shared_ptr<Base>>();
+    injector.get<std::shared_ptr<Base>>();
+
+    injector::set_resolution_observer(nullptr);
+
+    EXPECT_EQ(observer.resolutions, 2);
+    EXPECT_EQ(observer.constructions, 1);
+}
+
+TEST(Metrics, BorrowedSingletonIsCounted) {
+    if (!INJECTOR_ENABLE_METRICS)
+    {
+        GTEST_SKIP() << "Library built without INJECTOR_ENABLE_METRICS";
+    }
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+
+    // singleton does not publish its instance while metrics are enabled, thus every lookup reaches the binding
+    injector.get<std::shared_ptr<Base>>();
+    injector.get_ref<Base>();
+    injector.get_ref<Base>();
+    injector.for_each<Base>([](Base& base) {
+        EXPECT_EQ(base.foo(), 20);
+    });
+
+    auto metrics = injector.metrics();
+    ASSERT_EQ(metrics.size(), 1);
+    EXPECT_EQ(metrics[0].resolutions, 4);
+    EXPECT_EQ(metrics[0].constructions, 1);
+}
+
+TEST(Metrics, EmptyWhenDisabled) {
+    if (INJECTOR_ENABLE_METRICS)
+    {
+        GTEST_SKIP() << "Library built with INJECTOR_ENABLE_METRICS";
+    }
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.get<std::shared_ptr<Base>>();
+
+    EXPECT_TRUE(injector.metrics().empty());
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class OtherDerived : public Base
+{
+public:
+    int foo() override
+    {
+        return 30;
+    }
+};
+
+class Mailer
+{
+public:
+    explicit Mailer(std::shared_ptr<Base> transport)
+        : transport(std::move(transport))
+    {
+    }
+
+    std::shared_ptr<Base> transport;
+};
+
+class TransportModule : public injector::Module
+{
+public:
+    TransportModule()
+    {
+        add_singleton<Base, Derived>();
+    }
+};
+
+class MailModule : public injector::Module
+{
+public:
+    MailModule()
+    {
+        add<Mailer>();
+        try_add_singleton<Base, OtherDerived>();
+    }
+};
+
+TEST(Module, InstallsBindingsOfAllModules) {
+    TransportModule transport;
+    MailModule mail;
+
+    injector::Injector injector;
+    const auto generation = injector.generation();
+    injector.install(transport, mail);
+
+    ASSERT_EQ(injector.get<Mailer>()->transport->foo(), 20);
+    ASSERT_EQ(injector.get<Mailer>()->transport, injector.get<Base>());
+    ASSERT_NE(injector.generation(), generation);
+    ASSERT_EQ(transport.size(), 0);
+    ASSERT_EQ(mail.size(), 0);
+}
+
+TEST(Module, TryAddSeesExistingBindings) {
+    injector::Injector injector;
+    injector.add<Base, OtherDerived>();
+    injector.install(MailModule());
+
+    ASSERT_EQ(injector.get<Base>()->foo(), 30);
+    ASSERT_EQ(injector.get<std::vector<std::shared_ptr<Base>>>().size(), 1);
+}
+
+TEST(Module, KeepsRegistrationOrderOfMultiBindings) {
+    injector::Module module;
+    module.add<Base, Derived>();
+    module.add<Base, OtherDerived>();
+    module.try_add<Base, Derived>();
+
+    injector::Injector injector;
+    injector.install(std::move(module));
+
+    std::vector<int> values;
+    injector.for_each<Base>([&](Base& base) {
+        values.push_back(base.foo());
+    });
+
+    ASSERT_EQ(values, (std::vector<int>{20, 30}));
+    ASSERT_EQ(injector.get<Base>()->foo(), 30);
+}
+
+TEST(Module, TryAddInChildRespectsParentBindings) {
+    injector::Injector parent;
+    parent.add_singleton<Base, Derived>();
+
+    auto child = parent.create_child();
+    child.install(MailModule());
+
+    ASSERT_EQ(child.get<Base>(), parent.get<Base>());
+    ASSERT_EQ(child.get<Mailer>()->transport->foo(), 20);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <injector/injector.hpp>
+
+using ::testing::SizeIs;
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class OtherDerived : public Base
+{
+public:
+    int foo() override
+    {
+        return 30;
+    }
+};
+
+TEST(MultiBinding, ForEachVisitsBindingsInRegistrationOrder) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Base, OtherDerived>();
+
+    std::vector<int> values;
+    injector.for_each<Base>([&](Base& base) {
+        values.push_back(base.foo());
+    });
+
+    EXPECT_EQ(values, (std::vector<int>{20, 30}));
+}
+
+TEST(MultiBinding, ForEachWithoutRegistrations) {
+    injector::Injector injector;
+
+    int call_count = 0;
+    injector.for_each<Base>([&](Base& /*base*/) {
+        call_count += 1;
+    });
+
+    EXPECT_EQ(call_count, 0);
+}
+
+TEST(MultiBinding, ReferencesToSingletonBindingsStayStable) {
+    auto value = std::make_shared<OtherDerived>();
+
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Base, OtherDerived>(value);
+
+    auto refs1 = injector.get_refs<Base>();
+    auto refs2 = injector.get_refs<Base>();
+
+    ASSERT_THAT(refs1, SizeIs(2));
+    EXPECT_EQ(&refs1[0].get(), &refs2[0].get());
+    EXPECT_EQ(&refs1[1].get(), value.get());
+    EXPECT_EQ(refs1[0].get().foo(), 20);
+}
+
+TEST(MultiBinding, ReferencesToTransientBindingsAreNotAllowed) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Base, OtherDerived>();
+
+    ASSERT_THROW(injector.get_refs<Base>(), injector::ComponentCreationException);
+}
@@ -0,0 +1,107 @@
+// Built with exceptions disabled against library built the same way, thus it cannot use gtest
+#include <injector/injector.hpp>
+
+#include <cstdio>
+
+static_assert(!INJECTOR_HAS_EXCEPTIONS, "Test must be built without exceptions");
+
+#define EXPECT(condition)                                                        \
+    do                                                                           \
+    {                                                                            \
+        if (!(condition))                                                        \
+        {                                                                        \
+            std::fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures;                                                          \
+        }                                                                        \
+    } while (false)
+
+namespace
+{
+    int failures = 0;
+
+    class Base
+    {
+    public:
+        virtual int foo() = 0;
+
+        virtual ~Base() = default;
+    };
+
+    class Derived : public Base
+    {
+    public:
+        int foo() override
+        {
+            return 20;
+        }
+    };
+
+    // Dereferences its dependency, so it must never be constructed without it
+    class Reader
+    {
+    public:
+        explicit Reader(const std::shared_ptr<Base>& base)
+            : value(base->foo())
+        {
+            ++constructed;
+        }
+
+        int value;
+
+        static inline int constructed = 0;
+    };
+
+    void bound_type_is_retrieved()
+    {
+        injector::Injector injector;
+        injector.add_singleton<Base, Derived>();
+
+        auto res = injector.try_get<Base>();
+
+        EXPECT(res);
+        EXPECT(res && res->foo() == 20);
+        EXPECT(&injector.get_ref<Base>() == res.value().get());
+    }
+
+    void missing_dependency_is_reported()
+    {
+        injector::Injector injector;
+        injector.add_singleton<Reader>();
+
+        auto res = injector.try_get<Reader>();
+
+        EXPECT(!res);
+        EXPECT(res.error().code == injector::ErrorCode::Unbound);
+        EXPECT(res.error().type == injector::type_id<Base>());
+        EXPECT(Reader::constructed == 0);
+
+        injector.add<Base, Derived>();
+        res = injector.try_get<Reader>();
+
+        EXPECT(res && res->value == 20);
+        EXPECT(Reader::constructed == 1);
+    }
+
+    void failed_factory_is_reported()
+    {
+        injector::Injector injector;
+        injector.add<Base>([]() -> std::shared_ptr<Base> {
+            return nullptr;
+        });
+
+        auto res = injector.try_get<Base>();
+
+        EXPECT(!res);
+        EXPECT(res.error().code == injector::ErrorCode::CreationFailed);
+        EXPECT(res.error().type == injector::type_id<Base>());
+    }
+} // namespace
+
+int main()
+{
+    bound_type_is_retrieved();
+    missing_dependency_is_reported();
+    failed_factory_is_reported();
+
+    return failures == 0 ? 0 : 1;
+}
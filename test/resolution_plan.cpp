@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <atomic>
+#include <thread>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class OtherDerived : public Base
+{
+public:
+    int foo() override
+    {
+        return 30;
+    }
+};
+
+class Leaf
+{
+public:
+    explicit Leaf(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+class Root
+{
+public:
+    Root(std::shared_ptr<Leaf> first, std::shared_ptr<Leaf> second, std::shared_ptr<Base> base)
+        : first(std::move(first)),
+          second(std::move(second)),
+          base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Leaf> first;
+    std::shared_ptr<Leaf> second;
+    std::shared_ptr<Base> base;
+};
+
+TEST(ResolutionPlan, RepeatedResolutionProducesSameGraph) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Leaf>();
+    injector.add<Root>();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto root = injector.get<Root>();
+
+        EXPECT_NE(root->first, root->second);
+        EXPECT_EQ(root->first->base, root->base);
+        EXPECT_EQ(root->second->base, root->base);
+        EXPECT_EQ(root->base->foo(), 20);
+    }
+}
+
+TEST(ResolutionPlan, PlanIsRecompiledAfterNewRegistration) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+    injector.add<Leaf>();
+
+    EXPECT_EQ(injector.get<Leaf>()->base->foo(), 20);
+
+    injector.add<Base, OtherDerived>();
+
+    EXPECT_EQ(injector.get<Leaf>()->base->foo(), 30);
+}
+
+TEST(ResolutionPlan, UnregisteredDependencyIsConstructedOnEachResolution) {
+    injector::Injector injector;
+    injector.add<Root>();
+    injector.add<Base, Derived>();
+
+    auto res1 = injector.get<Root>();
+    auto res2 = injector.get<Root>();
+
+    EXPECT_NE(res1->first, res2->first);
+    EXPECT_EQ(res2->first->base->foo(), 20);
+}
+
+TEST(ResolutionPlan, PlanIsReusedAfterFreezing) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<Leaf>();
+
+    auto before = injector.get<Leaf>();
+    auto frozen = injector.freeze();
+    auto after = frozen.get<Leaf>();
+
+    EXPECT_EQ(before->base, after->base);
+}
+
+TEST(ResolutionPlan, ConcurrentTenantsNeverReceiveProvidersOfEachOther) {
+    constexpr int iterations = 100000;
+
+    injector::Injector parent;
+    parent.add<Leaf>();
+
+    auto first = parent.create_child();
+    first.add<Base, Derived>();
+
+    auto second = parent.create_child();
+    second.add<Base, OtherDerived>();
+
+    std::atomic<int> mismatches = 0;
+
+    auto resolve = [&mismatches](injector::InjectorBase& tenant, int expected) {
+        for (int i = 0; i < iterations; ++i)
+        {
+            if (tenant.get<Leaf>()->base->foo() != expected)
+            {
+                mismatches.fetch_add(1);
+            }
+        }
+    };
+
+    std::thread first_thread(resolve, std::ref(first), 20);
+    std::thread second_thread(resolve, std::ref(second), 30);
+
+    first_thread.join();
+    second_thread.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
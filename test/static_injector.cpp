@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <injector/static_injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Config
+{
+public:
+    int value = 10;
+};
+
+class Service
+{
+public:
+    Service(Config& config, Base& base)
+        : config(config),
+          base(base)
+    {
+    }
+
+    Config& config;
+    Base& base;
+};
+
+class Handler
+{
+public:
+    Handler(const Service& service, Derived worker)
+        : service(service),
+          worker(worker)
+    {
+    }
+
+    const Service& service;
+    Derived worker;
+};
+
+class Holder
+{
+public:
+    explicit Holder(std::unique_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::unique_ptr<Base> base;
+};
+
+using Singletons = injector::StaticInjector<
+    injector::Singleton<Service>,
+    injector::Singleton<Config>,
+    injector::Singleton<Base, Derived>>;
+
+TEST(StaticInjector, SingletonsAreReturnedByReference) {
+    Singletons injector;
+
+    auto& service = injector.get<Service>();
+
+    EXPECT_EQ(&service, &injector.get<Service>());
+    EXPECT_EQ(&service.config, &injector.get<Config>());
+    EXPECT_EQ(&service.base, &injector.get<Base>());
+    EXPECT_EQ(service.base.foo(), 20);
+}
+
+TEST(StaticInjector, TransientsAreConstructedDirectly) {
+    injector::StaticInjector<
+        injector::Singleton<Config>,
+        injector::Singleton<Base, Derived>,
+        injector::Singleton<Service>,
+        injector::Transient<Handler>,
+        injector::Transient<Derived>>
+        injector;
+
+    Handler handler1 = injector.get<Handler>();
+    Handler handler2 = injector.get<Handler>();
+    Derived derived = injector.get<Derived>();
+
+    EXPECT_EQ(&handler1.service, &handler2.service);
+    EXPECT_EQ(handler1.service.config.value, 10);
+    EXPECT_EQ(handler1.worker.foo(), 20);
+    EXPECT_EQ(derived.foo(), 20);
+}
+
+TEST(StaticInjector, TransientFromBaseIsReturnedAsUniquePointer) {
+    injector::StaticInjector<
+        injector::Transient<Base, Derived>,
+        injector::Transient<Holder>>
+        injector;
+
+    std::unique_ptr<Base> res1 = injector.get<Base>();
+    std::unique_ptr<Base> res2 = injector.get<Base>();
+    Holder holder = injector.get<Holder>();
+
+    EXPECT_EQ(res1->foo(), 20);
+    EXPECT_NE(res1, res2);
+    EXPECT_EQ(holder.base->foo(), 20);
+}
+
+TEST(StaticInjector, LastBindingWins) {
+    class OtherConfig : public Config
+    {
+    public:
+        OtherConfig()
+        {
+            value = 30;
+        }
+    };
+
+    injector::StaticInjector<
+        injector::Singleton<Config>,
+        injector::Singleton<Config, OtherConfig>>
+        injector;
+
+    EXPECT_EQ(injector.get<Config>().value, 30);
+}
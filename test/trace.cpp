@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <sstream>
+
+class Settings
+{
+};
+
+class Connection
+{
+public:
+    explicit Connection(std::shared_ptr<Settings> config)
+        : config(std::move(config))
+    {
+    }
+
+    std::shared_ptr<Settings> config;
+};
+
+class Application
+{
+public:
+    explicit Application(std::shared_ptr<Connection> connection)
+        : connection(std::move(connection))
+    {
+    }
+
+    std::shared_ptr<Connection> connection;
+};
+
+TEST(ConstructionTrace, RecordsNestedConstructions) {
+    injector::Injector injector;
+    injector.add_singleton<Settings>();
+    injector.add_singleton<Connection>();
+    injector.add_singleton<Application>();
+
+    injector::ConstructionTrace trace;
+    trace.start();
+    injector.get<std::shared_ptr<Application>>();
+    trace.stop();
+    injector.get<std::shared_ptr<Application>>();
+
+    auto events = trace.events();
+    ASSERT_EQ(events.size(), 3);
+
+    EXPECT_EQ(events[0].name, "Application");
+    EXPECT_EQ(events[0].parent, injector::ConstructionTrace::no_parent);
+    EXPECT_EQ(events[1].name, "Connection");
+    EXPECT_EQ(events[1].parent, 0);
+    EXPECT_EQ(events[2].name, "Settings");
+    EXPECT_EQ(events[2].parent, 1);
+
+    for (const auto& event : events)
+    {
+        EXPECT_LE(event.start, event.end);
+    }
+
+    EXPECT_LE(events[0].start, events[1].start);
+    EXPECT_GE(events[0].end, events[1].end);
+}
+
+TEST(ConstructionTrace, NothingRecordedWhenInactive) {
+    injector::Injector injector;
+    injector.add<Settings>();
+
+    injector::ConstructionTrace trace;
+    injector.get<std::shared_ptr<Settings>>();
+
+    EXPECT_TRUE(trace.events().empty());
+}
+
+TEST(ConstructionTrace, WritesFoldedStacks) {
+    injector::Injector injector;
+    injector.add<Settings>();
+    injector.add<Connection>();
+
+    injector::ConstructionTrace trace;
+    trace.start();
+    injector.get<std::shared_ptr<Connection>>();
+    trace.stop();
+
+    std::ostringstream folded;
+    trace.write_folded_stacks(folded);
+    EXPECT_NE(folded.str().find("Connection "), std::string::npos);
+    EXPECT_NE(folded.str().find("Connection;Settings "), std::string::npos);
+
+    std::ostringstream chrome;
+    trace.write_chrome_trace(chrome);
+    EXPECT_EQ(chrome.str().rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(chrome.str().find("\"name\":\"Settings\",\"cat\":\"injector\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(chrome.str().find("\"parent\":\"Connection\""), std::string::npos);
+}
+
+TEST(ConstructionTrace, RestartInsideFactoryDropsConstructionsInProgress) {
+    injector::Injector injector;
+    injector::ConstructionTrace trace;
+
+    injector.add<Settings>();
+    injector.add<Connection>([&]() {
+        trace.start();
+        return std::make_shared<Connection>(injector.get<std::shared_ptr<Settings>>());
+    });
+
+    trace.start();
+    injector.get<std::shared_ptr<Connection>>();
+    trace.stop();
+
+    auto events = trace.events();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].name, "Settings");
+    EXPECT_EQ(events[0].parent, injector::ConstructionTrace::no_parent);
+    EXPECT_LE(events[0].start, events[0].end);
+
+    std::ostringstream folded;
+    trace.write_folded_stacks(folded);
+    EXPECT_EQ(folded.str().rfind("Settings ", 0), 0);
+
+    std::ostringstream chrome;
+    trace.write_chrome_trace(chrome);
+    EXPECT_NE(chrome.str().find("\"parent\":\"\""), std::string::npos);
+}
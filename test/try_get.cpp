@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class Consumer
+{
+public:
+    explicit Consumer(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+// Dereferences its dependency, so it must never be constructed without it
+class Reader
+{
+public:
+    explicit Reader(const std::shared_ptr<Base>& base)
+        : value(base->foo())
+    {
+        ++constructed;
+    }
+
+    int value;
+
+    static inline int constructed = 0;
+};
+
+class Report
+{
+public:
+    explicit Report(std::shared_ptr<Reader> reader)
+        : reader(std::move(reader))
+    {
+    }
+
+    std::shared_ptr<Reader> reader;
+};
+
+TEST(TryGet, RetrievingBoundType) {
+    injector::Injector injector;
+    injector.add<Base, Derived>();
+
+    auto res = injector.try_get<std::shared_ptr<Base>>();
+
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->foo(), 20);
+}
+
+TEST(TryGet, MissingBindingIsReportedAsError) {
+    injector::Injector injector;
+
+    auto res = injector.try_get<Base>();
+
+    ASSERT_FALSE(res.has_value());
+    EXPECT_EQ(res.value(), nullptr);
+    EXPECT_EQ(res.error().code, injector::ErrorCode::Unbound);
+    EXPECT_EQ(res.error().type, injector::type_id<Base>());
+}
+
+TEST(TryGet, FailedDependencyIsReported) {
+    injector::Injector injector;
+    injector.add_singleton<Consumer>();
+
+    auto res = injector.try_get<Consumer>();
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code, injector::ErrorCode::Unbound);
+    EXPECT_EQ(res.error().type, injector::type_id<Base>());
+
+    injector.add<Base, Derived>();
+
+    EXPECT_TRUE(injector.try_get<Consumer>());
+}
+
+TEST(TryGet, ConstructorsOfMissingDependencyGraphAreNotInvoked) {
+    injector::Injector injector;
+    injector.add_singleton<Report>();
+
+    auto res = injector.try_get<Report>();
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code, injector::ErrorCode::Unbound);
+    EXPECT_EQ(res.error().type, injector::type_id<Base>());
+    EXPECT_EQ(Reader::constructed, 0);
+
+    injector.add<Base, Derived>();
+
+    res = injector.try_get<Report>();
+
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->reader->value, 20);
+}
+
+TEST(TryGet, FactoryReturningNull) {
+    injector::Injector injector;
+    injector.add<Base>([]() -> std::shared_ptr<Base> {
+        return nullptr;
+    });
+
+    auto res = injector.try_get<Base>();
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code, injector::ErrorCode::CreationFailed);
+    EXPECT_EQ(res.error().type, injector::type_id<Base>());
+
+    try
+    {
+        injector.get<Base>();
+        FAIL();
+    }
+    catch (const injector::ComponentCreationException& exception)
+    {
+        EXPECT_EQ(exception.error().code, injector::ErrorCode::CreationFailed);
+    }
+}
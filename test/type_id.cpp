@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+#include <injector/type_id.hpp>
+
+#include <vector>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+namespace
+{
+    class Widget
+    {
+    public:
+        int value = 1;
+    };
+} // namespace
+
+// defined in type_id_other_unit.cpp for a type that is also named Widget
+void add_other_unit_widget(injector::Injector& injector);
+int get_other_unit_widget(injector::Injector& injector);
+
+// keys must be usable in constant expressions
+static_assert(injector::type_id<int>() != injector::type_id<float>());
+static_assert(injector::type_id<Base>() == injector::TypeId::id<Base>());
+
+TEST(TypeId, DistinctTypesHaveDistinctKeys) {
+    EXPECT_NE(injector::type_id<Base>(), injector::type_id<Base*>());
+    EXPECT_NE(injector::type_id<Base>(), injector::type_id<const Base>());
+    EXPECT_NE(injector::type_id<std::vector<int>>(), injector::type_id<std::vector<long>>());
+}
+
+TEST(TypeId, TypeNameIsReadable) {
+    EXPECT_EQ(injector::type_name<Base>(), "Base");
+    EXPECT_EQ(injector::type_name<int>(), "int");
+    EXPECT_NE(injector::type_name<std::vector<int>>().find("vector"), std::string_view::npos);
+}
+
+TEST(TypeId, SameNamedTypesOfDifferentUnitsAreNotMixedUp) {
+    injector::Injector injector;
+    injector.add<Widget>();
+
+    ASSERT_THROW(add_other_unit_widget(injector), injector::ComponentCreationException);
+
+    try
+    {
+        get_other_unit_widget(injector);
+        FAIL();
+    }
+    catch (const injector::ComponentCreationException& exception)
+    {
+        EXPECT_EQ(exception.error().code, injector::ErrorCode::KeyCollision);
+    }
+
+    ASSERT_EQ(injector.get<Widget>()->value, 1);
+
+    injector::Injector other;
+    add_other_unit_widget(other);
+
+    ASSERT_EQ(get_other_unit_widget(other), 2);
+    ASSERT_THROW(other.get<Widget>(), injector::ComponentCreationException);
+}
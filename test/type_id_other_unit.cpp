@@ -0,0 +1,21 @@
+#include <injector/injector.hpp>
+
+// Same name as the type of type_id.cpp, yet distinct type
+namespace
+{
+    class Widget
+    {
+    public:
+        int value = 2;
+    };
+} // namespace
+
+void add_other_unit_widget(injector::Injector& injector)
+{
+    injector.add<Widget>();
+}
+
+int get_other_unit_widget(injector::Injector& injector)
+{
+    return injector.get<Widget>()->value;
+}
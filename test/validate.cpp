@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+class Base
+{
+public:
+    virtual int foo() = 0;
+
+    virtual ~Base() = default;
+};
+
+class Derived : public Base
+{
+public:
+    int foo() override
+    {
+        return 20;
+    }
+};
+
+class UserRepository
+{
+public:
+    explicit UserRepository(std::shared_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::shared_ptr<Base> base;
+};
+
+class UserService
+{
+public:
+    UserService(std::shared_ptr<UserRepository> repository, std::vector<std::shared_ptr<Base>> all)
+        : repository(std::move(repository)),
+          all(std::move(all))
+    {
+    }
+
+    std::shared_ptr<UserRepository> repository;
+    std::vector<std::shared_ptr<Base>> all;
+};
+
+class CycleSecond;
+
+class CycleFirst
+{
+public:
+    explicit CycleFirst(std::shared_ptr<CycleSecond> second)
+        : second(std::move(second))
+    {
+    }
+
+    std::shared_ptr<CycleSecond> second;
+};
+
+class CycleSecond
+{
+public:
+    explicit CycleSecond(std::shared_ptr<CycleFirst> first)
+        : first(std::move(first))
+    {
+    }
+
+    std::shared_ptr<CycleFirst> first;
+};
+
+class LazyCycle
+{
+public:
+    explicit LazyCycle(injector::Lazy<CycleFirst> first)
+        : first(std::move(first))
+    {
+    }
+
+    injector::Lazy<CycleFirst> first;
+};
+
+class ExclusiveOwner
+{
+public:
+    explicit ExclusiveOwner(std::unique_ptr<Base> base)
+        : base(std::move(base))
+    {
+    }
+
+    std::unique_ptr<Base> base;
+};
+
+// Validated during static initialization, dependency tables must not depend on initializers that might run later
+const auto static_errors = []() {
+    injector::Injector injector;
+    injector.add<UserService>();
+
+    return injector.validate();
+}();
+
+TEST(Validate, ValidGraphHasNoErrors) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<UserService>();
+
+    EXPECT_TRUE(injector.validate().empty());
+}
+
+TEST(Validate, ReportsMissingBindingWithPath) {
+    injector::Injector injector;
+    injector.add<UserService>();
+
+    auto errors = injector.validate();
+    ASSERT_EQ(errors.size(), 1);
+
+    EXPECT_EQ(errors[0].code, injector::ErrorCode::Unbound);
+    EXPECT_EQ(errors[0].type, injector::type_id<Base>());
+    EXPECT_EQ(errors[0].path, (std::vector<std::string_view>{"UserService", "UserRepository", "Base"}));
+}
+
+TEST(Validate, ReportsMissingBindingDuringStaticInitialization) {
+    ASSERT_EQ(static_errors.size(), 1);
+
+    EXPECT_EQ(static_errors[0].code, injector::ErrorCode::Unbound);
+    EXPECT_EQ(static_errors[0].type, injector::type_id<Base>());
+    EXPECT_EQ(static_errors[0].path, (std::vector<std::string_view>{"UserService", "UserRepository", "Base"}));
+}
+
+TEST(Validate, ReportsCycle) {
+    injector::Injector injector;
+    injector.add_singleton<CycleFirst>();
+    injector.add_singleton<CycleSecond>();
+
+    auto errors = injector.validate();
+    ASSERT_EQ(errors.size(), 1);
+
+    EXPECT_EQ(errors[0].code, injector::ErrorCode::Cycle);
+    EXPECT_EQ(errors[0].path, (std::vector<std::string_view>{"CycleFirst", "CycleSecond", "CycleFirst"}));
+}
+
+TEST(Validate, LazyDependencyBreaksCycle) {
+    injector::Injector injector;
+    injector.add<LazyCycle>();
+    injector.add<CycleFirst>([](std::shared_ptr<LazyCycle> /*second*/) {
+        return std::shared_ptr<CycleFirst>();
+    });
+
+    EXPECT_TRUE(injector.validate().empty());
+}
+
+TEST(Validate, ReportsUniqueDependencyOnSingleton) {
+    injector::Injector injector;
+    injector.add_singleton<Base, Derived>();
+    injector.add<ExclusiveOwner>();
+
+    auto errors = injector.validate();
+    ASSERT_EQ(errors.size(), 1);
+
+    EXPECT_EQ(errors[0].code, injector::ErrorCode::NotTransient);
+    EXPECT_EQ(errors[0].path, (std::vector<std::string_view>{"ExclusiveOwner", "Base"}));
+}
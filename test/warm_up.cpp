@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <injector/injector.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+class First
+{
+public:
+    First()
+    {
+        s_Instances += 1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    static inline std::atomic<int> s_Instances = 0;
+};
+
+class Second
+{
+public:
+    explicit Second(std::shared_ptr<First> first)
+        : first(std::move(first))
+    {
+        s_Instances += 1;
+    }
+
+    std::shared_ptr<First> first;
+
+    static inline std::atomic<int> s_Instances = 0;
+};
+
+class Transient
+{
+public:
+    Transient()
+    {
+        s_Instances += 1;
+    }
+
+    static inline std::atomic<int> s_Instances = 0;
+};
+
+class ThreadExecutor
+{
+public:
+    ThreadExecutor() = default;
+
+    ThreadExecutor(const ThreadExecutor&) = delete;
+    ThreadExecutor& operator=(const ThreadExecutor&) = delete;
+
+    ~ThreadExecutor()
+    {
+        for (auto& thread : m_Threads)
+        {
+            thread.join();
+        }
+    }
+
+    void operator()(std::function<void()> task)
+    {
+        m_Threads.emplace_back(std::move(task));
+    }
+
+private:
+    std::vector<std::thread> m_Threads;
+};
+
+TEST(WarmUp, SingletonsAreCreatedOnceOnExecutorThreads) {
+    First::s_Instances = 0;
+    Second::s_Instances = 0;
+    Transient::s_Instances = 0;
+
+    injector::Injector injector;
+    injector.add<Transient>();
+    injector.add_singleton<Second>();
+    injector.add_singleton<First>();
+
+    ThreadExecutor executor;
+    injector.warm_up([&](std::function<void()> task) {
+        executor(std::move(task));
+    });
+
+    EXPECT_EQ(First::s_Instances, 1);
+    EXPECT_EQ(Second::s_Instances, 1);
+    EXPECT_EQ(Transient::s_Instances, 0);
+
+    EXPECT_EQ(injector.get<Second>()->first, injector.get<First>());
+    EXPECT_EQ(First::s_Instances, 1);
+}
+
+TEST(WarmUp, SerialWarmUp) {
+    First::s_Instances = 0;
+
+    injector::Injector injector;
+    injector.add_singleton<First>();
+
+    injector.warm_up();
+    injector.get<First>();
+
+    EXPECT_EQ(First::s_Instances, 1);
+}
+
+TEST(WarmUp, FailingSingletonIsReported) {
+    injector::Injector injector;
+    injector.add_singleton<First>([] {
+        return std::shared_ptr<First>();
+    });
+
+    ASSERT_THROW(injector.warm_up(), injector::ComponentCreationException);
+}